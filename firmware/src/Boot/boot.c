@@ -0,0 +1,149 @@
+#define _BOOT_C
+
+#include "application.h"
+#include "boot.h"
+#include "Protocol/protocol.h"
+#include "Lib/MET_Bootloader_table.h"
+#include "Update/update.h"
+
+static volatile uint32_t bootTimes[BOOT_STAGES_NUM];   //!< Stage time stamps (us from the reset handler)
+static uint32_t bootCycles = 0;         //!< Cycle counter at the last stamp
+static uint32_t bootResidue = 0;        //!< Cycles not converted at the last stamp
+static uint32_t bootElapsed = 0;        //!< Time (us) from the reset handler at the last stamp
+static uint32_t bootMhz = BOOT_CPU_MHZ_DFLL;    //!< CPU clock (MHz) since the last stamp
+static uint8_t resetCause = 0;          //!< RSTC RCAUSE of the current boot
+static uint8_t previousStage = BOOT_STAGE_UNKNOWN;  //!< Last stage completed by the previous boot
+static bool statusInitialized = false;  //!< Reset cause and previous stage reported
+static bool statusCompleted = false;    //!< First CAN response time reported
+
+/**
+ * This is the reset handler hook (startup_xc32.c),
+ * called before the C runtime initialization.
+ *
+ * The function starts the DWT cycle counter from 0 and 
+ * the WDT of an image in trial (see UpdateResetHook()):
+ * no RAM variable can be used here.
+ */
+void _on_reset(void){
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    
+    UpdateResetHook();
+}
+
+/**
+ * This function returns the current CPU clock (MHz) from the GCLK0 source.
+ */
+static uint32_t bootCpuMhz(void){
+    uint32_t source = (GCLK_REGS->GCLK_GENCTRL[0] & GCLK_GENCTRL_SRC_Msk) >> GCLK_GENCTRL_SRC_Pos;
+    return (source == BOOT_GCLK_SRC_DPLL0) ? BOOT_CPU_MHZ_DPLL : BOOT_CPU_MHZ_DFLL;
+}
+
+/**
+ * This function initializes the module.
+ *
+ * The function shall be called at the beginning of the SYS_Initialize():
+ * - after a warm reset, the last stage completed by the previous boot
+ *   is read from the bootloader RAM table;
+ * - the BOOT_STAGE_STARTUP is stamped.
+ */
+void BootInit(void){
+    ramBootloaderTable = (uint32_t *) _MET_BOOTLOADER_RAM_START;
+
+    bootCycles = 0;
+    bootResidue = 0;
+    bootElapsed = 0;
+    bootMhz = bootCpuMhz();
+    for(int i = 0; i < BOOT_STAGES_NUM; i++) bootTimes[i] = 0;
+    statusInitialized = false;
+    statusCompleted = false;
+
+    // The RAM is preserved only by a warm reset
+    resetCause = RSTC_REGS->RSTC_RCAUSE;
+    previousStage = BOOT_STAGE_UNKNOWN;
+    if(resetCause & BOOT_WARM_CAUSES){
+        uint32_t stage = ramBootloaderTable[_MET_BOOTLOADER_SPARE1] >> 24;
+        if(stage < BOOT_STAGES_NUM) previousStage = (uint8_t) stage;
+    }
+
+    BootStage(BOOT_STAGE_STARTUP);
+}
+
+/**
+ * This function stamps the end of a boot stage.
+ *
+ * The elapsed cycles are converted with the CPU clock at the stage start.
+ * The stamp is also written in the _MET_BOOTLOADER_SPARE1 word of the bootloader RAM table.
+ *
+ * The function can be called by any task or interrupt routine.
+ *
+ * @param stage: this is the completed stage
+ */
+void BootStage(BOOT_STAGE_ENUM_t stage){
+    if(stage >= BOOT_STAGES_NUM) return;
+
+    UBaseType_t status = taskENTER_CRITICAL_FROM_ISR();
+    uint32_t now = DWT->CYCCNT;
+    uint32_t cycles = now - bootCycles + bootResidue;
+    bootElapsed += cycles / bootMhz;
+    bootResidue = cycles % bootMhz;
+    bootCycles = now;
+    bootMhz = bootCpuMhz();
+
+    bootTimes[stage] = bootElapsed;
+    ramBootloaderTable[_MET_BOOTLOADER_SPARE1] = ((uint32_t) stage << 24) | ((bootElapsed > 0xFFFFFF) ? 0xFFFFFF : bootElapsed);
+    taskEXIT_CRITICAL_FROM_ISR(status);
+}
+
+/**
+ * This function stamps the first CAN frame transmitted (BOOT_STAGE_RESPONSE).
+ *
+ * The function is called by the CAN0 interrupt routine when a transmission is completed.
+ * Beyond BOOT_TIME_SPAN ms the cycle counter can have overflowed:
+ * the time is set to BOOT_TIME_OVERFLOW.
+ */
+void BootCanTransmitted(void){
+    if(bootTimes[BOOT_STAGE_RESPONSE]) return;
+
+    if(xTaskGetTickCountFromISR() >= pdMS_TO_TICKS(BOOT_TIME_SPAN)) bootTimes[BOOT_STAGE_RESPONSE] = BOOT_TIME_OVERFLOW;
+    else BootStage(BOOT_STAGE_RESPONSE);
+}
+
+/**
+ * This function updates the BOOT_STATUS_REGISTER.
+ *
+ * The function is called by the Protocol task:
+ * the register is written once, when the first CAN frame is transmitted.
+ */
+void BootLoop(void){
+    if(statusCompleted) return;
+
+    if(!statusInitialized){
+        statusInitialized = true;
+        SETBYTE_BOOT(BOOT_CAUSE_BYTE, resetCause);
+        SETBYTE_BOOT(BOOT_STAGE_BYTE, previousStage);
+    }
+
+    uint32_t time = bootTimes[BOOT_STAGE_RESPONSE];
+    if(time == 0) return;
+
+    time = (time == BOOT_TIME_OVERFLOW) ? 0xFFFF : time / 100;
+    if(time > 0xFFFF) time = 0xFFFF;
+    SETBYTE_BOOT(BOOT_RESPONSE_LSB_BYTE, (uint8_t) time);
+    SETBYTE_BOOT(BOOT_RESPONSE_MSB_BYTE, (uint8_t) (time >> 8));
+    statusCompleted = true;
+}
+
+/**
+ * This function reads a stage time stamp.
+ *
+ * @param stage: this is the stage (BOOT_STAGE_xx)
+ * @param value: this is the stage end time (us from the reset handler, 0 = not reached)
+ * @return false if the stage is not valid
+ */
+bool BootRead(uint8_t stage, uint32_t* value){
+    if(stage >= BOOT_STAGES_NUM) return false;
+    *value = bootTimes[stage];
+    return true;
+}
@@ -0,0 +1,126 @@
+#ifndef _BOOT_H
+#define _BOOT_H
+
+#include "definitions.h"
+#include "application.h"
+
+#undef ext
+#undef ext_static
+
+#ifdef _BOOT_C
+    #define ext
+    #define ext_static static
+#else
+    #define ext extern
+    #define ext_static extern
+#endif
+
+/*!
+ * \defgroup bootModule Boot time measurement module
+ *
+ * \ingroup applicationModule
+ *
+ *
+ * This Module measures the time from a reset to the first CAN frame
+ * transmitted by the application.
+ *
+ * ## Dependencies
+ *
+ * - DWT unit of the Cortex-M4 core (CYCCNT register);
+ * - RSTC module (reset cause);
+ * - Bootloader RAM table: _MET_BOOTLOADER_SPARE1 word (see Lib/MET_Bootloader_table.h);
+ *
+ * ## Stage time stamps
+ *
+ * The cycle counter is started by the reset handler (_on_reset(),
+ * before the C runtime initialization). BootStage() is called at the end of every boot stage
+ * (see BOOT_STAGE_ENUM_t):
+ * - the SYS_Initialize() steps (config/default/initialization.c: the calls
+ *   shall be restored after a Harmony 3 regeneration);
+ * - the modules initialization and the tasks creation in the main();
+ * - the first run of the Protocol task;
+ * - the first CAN frame transmitted (CAN0 interrupt).
+ *
+ * A stage time is converted with the CPU clock at the stage start, read from the GCLK0 source:
+ * 48MHz (DFLL) up to the CLOCK stage, 120MHz (DPLL0) after. The few channel settings following
+ * the CPU clock switch at the end of CLOCK_Initialize() are counted at 48MHz.
+ * The time stamps (us from the reset handler) are read with the GET_BOOT_TIME command.
+ *
+ * Every stamp is also written in the _MET_BOOTLOADER_SPARE1 word of the bootloader RAM table:
+ * - bits 24..31: the last completed stage (BOOT_STAGE_xx);
+ * - bits 0..23: the time (us, max 0xFFFFFF) from the reset handler.
+ *
+ * The table is outside the application and bootloader RAM and survives a warm reset
+ * (system reset request, watchdog, NVM bank swap or reset pin): after a hang or a fault reset,
+ * the next boot reports the last stage completed by the previous one.
+ *
+ * ## Status register
+ *
+ * The BOOT_STATUS_REGISTER reports:
+ * - byte 0: reset cause (RSTC RCAUSE);
+ * - byte 1: last stage completed by the previous boot
+ *   (BOOT_STAGE_UNKNOWN after a power-on);
+ * - bytes 2..3: time (100us units, max 0xFFFF) from the reset handler to the first CAN frame transmitted.
+ *
+ *  @{
+ *
+ */
+
+     /**
+    * \defgroup bootStructModule Module Data structures
+    *  @{
+    */
+
+    /// This is the list of the boot stages
+    typedef enum{
+        BOOT_STAGE_STARTUP = 0,     //!< C runtime initialization (.data, .bss)
+        BOOT_STAGE_NVMCTRL,         //!< NVMCTRL wait states
+        BOOT_STAGE_PORT,            //!< Pin setting
+        BOOT_STAGE_CLOCK,           //!< Clock generators and DPLL0 lock
+        BOOT_STAGE_DMAC,            //!< EVSYS and DMAC
+        BOOT_STAGE_ADC,             //!< ADC0 and ADC1
+        BOOT_STAGE_CAN,             //!< CAN0
+        BOOT_STAGE_TIMERS,          //!< TC1, RTC, TC0, TC2 and SERCOM5 (log)
+        BOOT_STAGE_NVIC,            //!< Interrupt controller
+        BOOT_STAGE_MODULES,         //!< Application modules and tasks creation
+        BOOT_STAGE_SCHEDULER,       //!< First run of the Protocol task
+        BOOT_STAGE_RESPONSE,        //!< First CAN frame transmitted
+        BOOT_STAGES_NUM             //!< Number of the stages (not a stage)
+    }BOOT_STAGE_ENUM_t;
+
+    /** @}*/ // bootStructModule
+
+     /**
+    * \defgroup bootApiModule API Module
+    *  @{
+    */
+
+        ext void BootInit(void);
+        ext void BootStage(BOOT_STAGE_ENUM_t stage);
+        ext void BootCanTransmitted(void);
+        ext void BootLoop(void);
+        ext bool BootRead(uint8_t stage, uint32_t* value);
+
+    /** @}*/ // bootApiModule
+
+    /**
+    * \defgroup bootMacroModule Module's Macros
+    *  @{
+    */
+
+        #define BOOT_CPU_MHZ_DFLL       48          //!< CPU clock (MHz) from the DFLL (reset value)
+        #define BOOT_CPU_MHZ_DPLL       120         //!< CPU clock (MHz) from the DPLL0
+        #define BOOT_GCLK_SRC_DPLL0     7           //!< GCLK generator source: DPLL0
+
+        #define BOOT_TIME_SPAN          30000       //!< Max measured time (ms): the cycle counter overflows in 35s at 120MHz
+        #define BOOT_TIME_OVERFLOW      0xFFFFFFFF  //!< Stage time beyond BOOT_TIME_SPAN
+        #define BOOT_STAGE_UNKNOWN      0x7F        //!< Last stage of the previous boot not available
+
+        #define BOOT_WARM_CAUSES        (RSTC_RCAUSE_SYST_Msk | RSTC_RCAUSE_WDT_Msk | RSTC_RCAUSE_NVM_Msk | RSTC_RCAUSE_EXT_Msk) //!< Reset causes preserving the RAM
+
+    /** @}*/ // bootMacroModule
+
+/** @}*/ // bootModule
+
+
+#endif
@@ -0,0 +1,112 @@
+#define _DIAGNOSTIC_C
+
+#include "application.h"
+#include "diagnostic.h"
+#include "Protocol/protocol.h"
+#include "timers.h"
+
+static DIAGNOSTIC_TASK_t diagnosticTasks[DIAGNOSTIC_TASKS_NUM]; //!< Monitored tasks
+static uint32_t lastRunTime = 0;    //!< Run time counter at the last period
+static TickType_t lastSample = 0;   //!< Tick of the last period
+static uint8_t minIdle = 100;       //!< Min idle (%) since the startup
+
+/**
+ * This function initializes the module.
+ */
+void DiagnosticInit(void){
+    for(int i = 0; i < DIAGNOSTIC_TASKS_NUM; i++){
+        diagnosticTasks[i].handle = NULL;
+        diagnosticTasks[i].stack = 0;
+        diagnosticTasks[i].runTime = 0;
+        diagnosticTasks[i].load = 0;
+        diagnosticTasks[i].peakLoad = 0;
+    }
+
+    SETBYTE_PEAK_LOAD(LOAD_IDLE_BYTE, minIdle);
+}
+
+/**
+ * This function registers an application task.
+ *
+ * @param task: this is the monitored task index
+ * @param handle: this is the task handle returned by xTaskCreate()
+ * @param stack: this is the task stack size (words)
+ */
+void DiagnosticAddTask(DIAGNOSTIC_TASK_ENUM_t task, TaskHandle_t handle, uint32_t stack){
+    if(task >= DIAGNOSTIC_TASKS_NUM) return;
+    diagnosticTasks[task].handle = handle;
+    diagnosticTasks[task].stack = stack;
+}
+
+/**
+ * This function returns a time share in %.
+ *
+ * @param time: this is the measured time
+ * @param period: this is the reference time
+ * @return the rounded percentage (max 100)
+ */
+static uint8_t diagnosticPercent(uint32_t time, uint32_t period){
+    if(period == 0) return 0;
+
+    uint32_t percent = (uint32_t) (((uint64_t) time * 100 + period / 2) / period);
+    if(percent > 100) percent = 100;
+    return (uint8_t) percent;
+}
+
+/**
+ * This function updates the diagnostic STATUS registers.
+ *
+ * The function is called by the Protocol task:
+ * the measures are updated every DIAGNOSTIC_PERIOD ms.
+ */
+void DiagnosticLoop(void){
+    TaskStatus_t status;
+
+    TickType_t now = xTaskGetTickCount();
+    if((now - lastSample) < pdMS_TO_TICKS(DIAGNOSTIC_PERIOD)) return;
+    lastSample = now;
+
+    // The kernel tasks are created by the scheduler
+    if(diagnosticTasks[DIAGNOSTIC_TASK_IDLE].handle == NULL){
+        DiagnosticAddTask(DIAGNOSTIC_TASK_IDLE, xTaskGetIdleTaskHandle(), configMINIMAL_STACK_SIZE);
+        DiagnosticAddTask(DIAGNOSTIC_TASK_TIMER, xTimerGetTimerDaemonTaskHandle(), configTIMER_TASK_STACK_DEPTH);
+    }
+
+    uint32_t runTime = portGET_RUN_TIME_COUNTER_VALUE();
+    uint32_t period = runTime - lastRunTime;
+    lastRunTime = runTime;
+
+    for(int i = 0; i < DIAGNOSTIC_TASKS_NUM; i++){
+        DIAGNOSTIC_TASK_t* t = &diagnosticTasks[i];
+        if(t->handle == NULL) continue;
+
+        // The task state is not used: eReady skips the state evaluation
+        vTaskGetInfo(t->handle, &status, pdFALSE, eReady);
+        t->load = diagnosticPercent(status.ulRunTimeCounter - t->runTime, period);
+        t->runTime = status.ulRunTimeCounter;
+        if(t->load > t->peakLoad) t->peakLoad = t->load;
+    }
+
+    uint8_t idle = diagnosticTasks[DIAGNOSTIC_TASK_IDLE].load;
+    if(idle < minIdle) minIdle = idle;
+
+    SETBYTE_LOAD(LOAD_IDLE_BYTE, idle);
+    SETBYTE_LOAD(LOAD_PROTOCOL_BYTE, diagnosticTasks[DIAGNOSTIC_TASK_PROTOCOL].load);
+    SETBYTE_LOAD(LOAD_MOTION_BYTE, diagnosticTasks[DIAGNOSTIC_TASK_MOTION].load);
+    SETBYTE_LOAD(LOAD_THERMAL_BYTE, diagnosticTasks[DIAGNOSTIC_TASK_THERMAL].load);
+
+    SETBYTE_PEAK_LOAD(LOAD_IDLE_BYTE, minIdle);
+    SETBYTE_PEAK_LOAD(LOAD_PROTOCOL_BYTE, diagnosticTasks[DIAGNOSTIC_TASK_PROTOCOL].peakLoad);
+    SETBYTE_PEAK_LOAD(LOAD_MOTION_BYTE, diagnosticTasks[DIAGNOSTIC_TASK_MOTION].peakLoad);
+    SETBYTE_PEAK_LOAD(LOAD_THERMAL_BYTE, diagnosticTasks[DIAGNOSTIC_TASK_THERMAL].peakLoad);
+
+    // Stack peak usage: the high water mark is the min free stack (words).
+    // The task index is the STACK_xx_BYTE index
+    for(int i = 0; i <= DIAGNOSTIC_TASK_TIMER; i++){
+        DIAGNOSTIC_TASK_t* t = &diagnosticTasks[i];
+        if((t->handle == NULL) || (t->stack == 0)) continue;
+
+        uint32_t used = t->stack - uxTaskGetStackHighWaterMark(t->handle);
+        SETBYTE_STACK(i, diagnosticPercent(used, t->stack));
+    }
+}
@@ -0,0 +1,112 @@
+#ifndef _DIAGNOSTIC_H
+#define _DIAGNOSTIC_H
+
+#include "definitions.h"
+#include "application.h"
+
+#undef ext
+#undef ext_static
+
+#ifdef _DIAGNOSTIC_C
+    #define ext
+    #define ext_static static
+#else
+    #define ext extern
+    #define ext_static extern
+#endif
+
+/*!
+ * \defgroup diagnosticModule CPU load and stack diagnostic module
+ *
+ * \ingroup applicationModule
+ *
+ *
+ * This Module measures the CPU share of every task, the idle time
+ * and the stack peak usage, so that the headroom of a board
+ * can be evaluated by the Host before adding new features.
+ *
+ * ## Dependencies
+ *
+ * - TC2/TC3 module: 32 bit free running counter (1.5MHz);
+ * - FreeRTOS run time statistics (configGENERATE_RUN_TIME_STATS);
+ *
+ * ## Harmony 3 configurator setting
+ *
+ * TC2 is configured in 32 bit Timer mode (TC3 slave), clocked by GCLK4 (24MHz)
+ * with prescaler DIV16. The counter is started by the scheduler
+ * (portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()) and read at every context switch
+ * (portGET_RUN_TIME_COUNTER_VALUE()): unlike the CPU cycle counter, it counts also
+ * while the Idle task waits in IDLE sleep mode.
+ * The counter overflows every 47 minutes: the measures are the differences
+ * on every period, so the overflow has no effect.
+ *
+ * ## Module Function Description
+ *
+ * The application tasks are registered with DiagnosticAddTask() when created;
+ * the Idle and the Timer service tasks are added by the module.
+ *
+ * Every DIAGNOSTIC_PERIOD ms the DiagnosticLoop(), called by the Protocol task,
+ * updates the following STATUS registers:
+ * - LOAD_STATUS_REGISTER: idle, Protocol, Motion and Thermal CPU share (%) in the last period;
+ * - PEAK_LOAD_STATUS_REGISTER: min idle and max task CPU share (%) since the startup;
+ * - STACK_STATUS_REGISTER: stack peak usage (%) of the Protocol, Motion, Thermal
+ *   and Timer service tasks.
+ *
+ * The interrupt routines are charged to the interrupted task
+ * (usually the Idle task): the CPU share of the Timer service task and
+ * the rounding make the difference from 100%.
+ *
+ *  @{
+ *
+ */
+
+     /**
+    * \defgroup diagnosticStructModule Module Data structures
+    *  @{
+    */
+
+    /// This is the list of the monitored tasks
+    typedef enum{
+        DIAGNOSTIC_TASK_PROTOCOL = 0,   //!< Protocol task
+        DIAGNOSTIC_TASK_MOTION,         //!< Motion task
+        DIAGNOSTIC_TASK_THERMAL,        //!< Thermal task
+        DIAGNOSTIC_TASK_TIMER,          //!< Timer service task (added by the module)
+        DIAGNOSTIC_TASK_IDLE,           //!< Idle task (added by the module)
+        DIAGNOSTIC_TASKS_NUM            //!< Number of the monitored tasks (not a task)
+    }DIAGNOSTIC_TASK_ENUM_t;
+
+    /// This is the monitored task data structure
+    typedef struct{
+        TaskHandle_t handle;    //!< Task handle (NULL if not registered)
+        uint32_t stack;         //!< Stack size (words)
+        uint32_t runTime;       //!< Task run time counter at the last period
+        uint8_t load;           //!< CPU share (%) in the last period
+        uint8_t peakLoad;       //!< Max CPU share (%) since the startup
+    }DIAGNOSTIC_TASK_t;
+
+    /** @}*/ // diagnosticStructModule
+
+     /**
+    * \defgroup diagnosticApiModule API Module
+    *  @{
+    */
+
+        ext void DiagnosticInit(void);
+        ext void DiagnosticAddTask(DIAGNOSTIC_TASK_ENUM_t task, TaskHandle_t handle, uint32_t stack);
+        ext void DiagnosticLoop(void);
+
+    /** @}*/ // diagnosticApiModule
+
+    /**
+    * \defgroup diagnosticMacroModule Module's Macros
+    *  @{
+    */
+
+        #define DIAGNOSTIC_PERIOD   1000        //!< Measure period (ms)
+
+    /** @}*/ // diagnosticMacroModule
+
+/** @}*/ // diagnosticModule
+
+
+#endif
@@ -3,6 +3,10 @@
 #include "application.h"
 #include "filter.h"
 #include "Protocol/protocol.h" 
+#include "Profiler/profiler.h"
+#include "PowerSave/power_save.h"
+#include "Log/log.h"
+#include "queue.h"
 
 #define MOTOR_LED_ON uc_DL9_Set();
 #define MOTOR_LED_OFF uc_DL9_Clear();
@@ -20,7 +24,12 @@
 #define MOTOR_CCW uc_DIR_Set()
 
 static void filterCallback(TC_COMPARE_STATUS status, uintptr_t context); //!< Callback every STEP pin changes
+static void filterSequence(void); //!< Positioning sequence step
+void stopMotor(STOPMODE_t cause, FASE_CURRENT_MODE_t torque); //!< Motor driver stop
 static volatile FILTER_MOTOR_t filterMotor; //!< Motor main structure variable declaration
+static uint32_t slotStepPosition[SLOT_NUMBER]; //!< Slot geometry cache: calibrated slot positions in steps
+static QueueHandle_t motionQueue = NULL; //!< Positioning requests (Filter codes) to the Motion task
+static TaskHandle_t motionTask = NULL; //!< Motion task handle, notified by the positioning termination
 
 /**
  * This function sets the Motor Torque
@@ -109,6 +118,24 @@ void startMotor(DIRECTION_t direction, MICROSTEP_t mc_mode, uint16_t final_perio
     
 }
 
+/**
+ * This function assigns a slot position at the module initialization.
+ * 
+ * A rejected position (see FilterSetSlotPosition()) is replaced 
+ * with the default position into both the PARAMETER register and the slot geometry cache,
+ * so the Host reads the position actually used by the motor.
+ * 
+ * @param filter: this is the protocol Filter code (POSITIONER_SELECT_xx)
+ * @param idx: this is the PARAMETER register of the slot position
+ * @param position: this is the calibrated position in um
+ */
+static void filterInitSlotPosition(uint8_t filter, uint8_t idx, uint16_t position){
+    if(FilterSetSlotPosition(filter, position)) return;
+    
+    MET_Can_Protocol_SetDefaultParameter(idx, 0, 0, 0, 0);
+    FilterSetSlotPosition(filter, 0);
+}
+
 /**
  * Module Filter initialization
  */
@@ -118,6 +145,13 @@ void FilterInit(void){
     filterMotor.command_sequence = 0;
     filterMotor.running = false; 
   
+    // Builds the slot geometry cache from the current parameters
+    filterInitSlotPosition(POSITIONER_SELECT_FILTER1, PROTO_PARAM_FILTER1_POSITION, GETWORD_PARAMETER_FILTER1_POSITION);
+    filterInitSlotPosition(POSITIONER_SELECT_FILTER2, PROTO_PARAM_FILTER2_POSITION, GETWORD_PARAMETER_FILTER2_POSITION);
+    filterInitSlotPosition(POSITIONER_SELECT_FILTER3, PROTO_PARAM_FILTER3_POSITION, GETWORD_PARAMETER_FILTER3_POSITION);
+    filterInitSlotPosition(POSITIONER_SELECT_FILTER4, PROTO_PARAM_FILTER4_POSITION, GETWORD_PARAMETER_FILTER4_POSITION);
+    filterInitSlotPosition(POSITIONER_SELECT_MIRROR, PROTO_PARAM_MIRROR_POSITION, GETWORD_PARAMETER_MIRROR_POSITION);
+    
     // Initializes the Protocol
     SETBYTE_SLOT_SELECTED(SYSTEM_OUT_POSITION);
     
@@ -131,6 +165,12 @@ void FilterInit(void){
     
     // Registers the working callback
     TC1_CompareCallbackRegister(filterCallback, 0);
+    
+    // The TC1 is clocked only during a positioning
+    PowerSaveApbaClock(MCLK_APBAMASK_TC1_Msk, false);
+
+    // Positioning requests to the Motion task
+    motionQueue = xQueueCreate(1, sizeof(uint8_t));
 
     
 }
@@ -152,42 +192,158 @@ bool FilterIsTarget(uint8_t filter){
     return true;
 }
 
+/**
+ * This function converts the protocol Filter code into the slot index
+ * 
+ * @param filter: this is the protocol Filter code (POSITIONER_SELECT_xx)
+ * @return the slot index or SLOT_INVALID if the code is not valid
+ */
+static uint8_t filterToSlot(uint8_t filter){
+    switch(filter){
+        case POSITIONER_SELECT_FILTER1: return FILTER1_SLOT;
+        case POSITIONER_SELECT_FILTER2: return FILTER2_SLOT;
+        case POSITIONER_SELECT_FILTER3: return FILTER3_SLOT;
+        case POSITIONER_SELECT_FILTER4: return FILTER4_SLOT;
+        case POSITIONER_SELECT_MIRROR:  return MIRROR_SLOT;
+        default: return SLOT_INVALID;
+    }
+}
+
+/**
+ * This function validates and stores a calibrated slot position 
+ * into the slot geometry cache.
+ * 
+ * The function is called at the module initialization and every time
+ * the related PARAMETER register is written by the protocol layer.
+ * 
+ * The position is the distance from the beginning of the light slot, 
+ * so it shall be smaller than the light slot dimension.
+ * 
+ * @param filter: this is the protocol Filter code (POSITIONER_SELECT_xx)
+ * @param position: this is the calibrated position in um
+ * @return true if the position is valid and has been stored
+ */
+bool FilterSetSlotPosition(uint8_t filter, uint16_t position){
+    uint8_t slot = filterToSlot(filter);
+    
+    if(slot == SLOT_INVALID) return false;
+    if(position >= light_slot_dim) return false;
+    
+    slotStepPosition[slot] = umToSteps(position);
+    return true;
+}
+
+/**
+ * This function requests a slot selection.
+ * 
+ * The request is validated and forwarded to the Motion task (see FilterTask()):
+ * the module is busy (FilterIsRunning()) from now up to the 
+ * positioning termination.
+ * 
+ * @param filter: this is the protocol Filter code (POSITIONER_SELECT_xx)
+ * @return true if the positioning is started
+ */
 bool FilterSelect(uint8_t filter){
 
     // Command Busy
     if(filterMotor.command_activated ) return false;
     
-    // Assignes the current target position
-    if(filter == POSITIONER_SELECT_FILTER1){ 
-        filterMotor.target_slot = FILTER1_SLOT;
-        filterMotor.target_slot_position[FILTER1_SLOT] = umToSteps(GETWORD_PARAMETER_FILTER1_POSITION);        
-    }  else if(filter == POSITIONER_SELECT_FILTER2){ 
-        filterMotor.target_slot = FILTER2_SLOT;
-        filterMotor.target_slot_position[FILTER2_SLOT] = umToSteps(GETWORD_PARAMETER_FILTER2_POSITION);
-    }  else if(filter == POSITIONER_SELECT_FILTER3){ 
-        filterMotor.target_slot = FILTER3_SLOT;
-        filterMotor.target_slot_position[FILTER3_SLOT] = umToSteps(GETWORD_PARAMETER_FILTER3_POSITION);
-    }  else if(filter == POSITIONER_SELECT_FILTER4){ 
-        filterMotor.target_slot = FILTER4_SLOT;
-        filterMotor.target_slot_position[FILTER4_SLOT] = umToSteps(GETWORD_PARAMETER_FILTER4_POSITION);
-    }  else if(filter == POSITIONER_SELECT_MIRROR){ 
-        filterMotor.target_slot = MIRROR_SLOT;
-        filterMotor.target_slot_position[MIRROR_SLOT] = umToSteps(GETWORD_PARAMETER_MIRROR_POSITION);
-    }  else return false; 
-    
- 
+    // Assignes the current target slot
+    uint8_t slot = filterToSlot(filter);
+    if(slot == SLOT_INVALID) return false;
+    filterMotor.target_slot = slot;
     filterMotor.target_filter = filter;
-    filterMotor.command_activated = true;        
-    filterMotor.command_sequence = 0;
     filterMotor.slot_valid = false;
+    filterMotor.command_activated = true;        
     
-    // Set the Protocol Filter status to running mode
-    SETBYTE_SLOT_SELECTED(SYSTEM_SELECTION_PENDING);
-    
-    startMotor(MOTOR_DIR_HOME,MOTOR_SPEED_HOME);                  
+    if(xQueueSend(motionQueue, &filter, 0) != pdTRUE){
+        filterMotor.command_activated = false;        
+        return false;
+    }
     return true;
 }
 
+/**
+ * This function updates the STATUS and ERROR registers 
+ * at the end of a positioning.
+ */
+static void filterPublish(void){
+    
+    if(!filterMotor.slot_valid){
+        SETBYTE_SLOT_SELECTED(SYSTEM_OUT_POSITION); // Sets the OUT OF POSITION on the Status register
+        setFilterError(true);        
+        return;
+    }
+    
+    // Sets the current selection on the STATUS register
+    if(filterMotor.target_filter == POSITIONER_SELECT_FILTER1) SETBYTE_SLOT_SELECTED(SYSTEM_FILTER1_SELECTED);
+    else if(filterMotor.target_filter == POSITIONER_SELECT_FILTER2) SETBYTE_SLOT_SELECTED(SYSTEM_FILTER2_SELECTED);
+    else if(filterMotor.target_filter == POSITIONER_SELECT_FILTER3) SETBYTE_SLOT_SELECTED(SYSTEM_FILTER3_SELECTED);
+    else if(filterMotor.target_filter == POSITIONER_SELECT_FILTER4) SETBYTE_SLOT_SELECTED(SYSTEM_FILTER4_SELECTED);
+    else if(filterMotor.target_filter == POSITIONER_SELECT_MIRROR) SETBYTE_SLOT_SELECTED(SYSTEM_MIRROR_SELECTED);
+    else{
+        setFilterError(true);
+        SETBYTE_SLOT_SELECTED(SYSTEM_OUT_POSITION);
+        return;
+    } 
+    setFilterError(false);
+}
+
+/**
+ * This function is the Motion supervisor task.
+ * 
+ * The task waits for a positioning request from FilterSelect(),
+ * latches the slot geometry and starts the motor: the positioning sequence 
+ * is executed by the TC1 interrupt (filterCallback()), that notifies the task
+ * at the end of the sequence.
+ * 
+ * If the sequence doesn't terminate within FILTER_MOTION_TIMEOUT ms
+ * the motor is stopped and the positioning fails.
+ * 
+ * The TC1 APB clock is enabled only during the positioning.
+ * 
+ * The task then updates the STATUS and ERROR registers and wakes up
+ * the Protocol task to complete the command.
+ * 
+ * @param param: not used
+ */
+void FilterTask(void* param){
+    uint8_t filter;
+    
+    motionTask = xTaskGetCurrentTaskHandle();
+    
+    while(true){
+        if(xQueueReceive(motionQueue, &filter, portMAX_DELAY) != pdTRUE) continue;
+        
+        // Latches the cached slot geometry for the whole positioning
+        for(int i = 0; i < SLOT_NUMBER; i++) filterMotor.target_slot_position[i] = slotStepPosition[i];
+        filterMotor.command_sequence = 0;
+
+        // Set the Protocol Filter status to running mode
+        SETBYTE_SLOT_SELECTED(SYSTEM_SELECTION_PENDING);
+
+        ulTaskNotifyTake(pdTRUE, 0);
+        LOG2(LOG_FILTER_START, filter, filterMotor.target_slot);
+        PowerSaveApbaClock(MCLK_APBAMASK_TC1_Msk, true);
+        startMotor(MOTOR_DIR_HOME,MOTOR_SPEED_HOME);                  
+        
+        // Positioning supervision
+        if(ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(FILTER_MOTION_TIMEOUT)) == 0){
+            TC1_CompareStop();
+            LOG1(LOG_FILTER_TIMEOUT, filterMotor.command_sequence);
+            if(filterMotor.running){
+                stopMotor(_STOP_BECAUSE_ERROR, _CURLIM_LOW);
+                filterMotor.slot_valid = false;
+            }
+        }
+        PowerSaveApbaClock(MCLK_APBAMASK_TC1_Msk, false);
+        
+        filterPublish();
+        filterMotor.command_activated = false;
+        ApplicationProtocolNotify();
+    }
+}
+
 /**
  * This function stops the motor driver.
  * 
@@ -233,12 +389,27 @@ void FilterTest(void){
 /**
  * This is the positioning Worker callback.
  * 
- * The function execute the positioning sequence.
+ * The function executes a step of the positioning sequence.
  * 
  * @param status
  * @param context
  */
 void filterCallback(TC_COMPARE_STATUS status, uintptr_t context){
+    PROFILER_START(PROFILER_PROBE_FILTER_CALLBACK);
+    filterSequence();
+    
+    // Step trace: a record (25 bytes, 125us at 2Mbaud) every STEP pin change,
+    // transmitted in less than the min period (150us) so no record is dropped at full speed
+    if(filterMotor.running) LOG4(LOG_FILTER_STEP, filterMotor.command_sequence, filterMotor.opto_status, filterMotor.current_pulses, TC1_Compare16bitPeriodGet());
+    PROFILER_STOP(PROFILER_PROBE_FILTER_CALLBACK);
+}
+
+/**
+ * This function executes the positioning sequence.
+ * 
+ * At the end of the sequence the Motion task is notified.
+ */
+static void filterSequence(void){
    
   
    static uint32_t stp=0;
@@ -469,47 +640,22 @@ void filterCallback(TC_COMPARE_STATUS status, uintptr_t context){
             break;                         
    }
    
-   // If an error condition was detected, the activation ends in 
-   if(error){
-        error = false;
-        stopMotor(_STOP_BECAUSE_ERROR, _CURLIM_LOW);
-        TC1_CompareStop();
-        filterMotor.command_activated = false;            
-        filterMotor.slot_valid = false;
+   // If an error condition or the complete activation was detected, the activation ends:
+   // the Motion task publishes the result
+   if(error || completed){
+        BaseType_t woken = pdFALSE;
         
-        unsigned char error_pers0;
-        MET_Can_Protocol_GetErrors(0, 0, &error_pers0, 0);
-        error_pers0 |= PERS0_FILTER_SEL_FAIL;       
-        MET_Can_Protocol_SetErrors(0, 0, &error_pers0, 0);
+        if(error) stopMotor(_STOP_BECAUSE_ERROR, _CURLIM_LOW);
+        else stopMotor(_STOP_BECAUSE_TARGET, _CURLIM_LOW);
+        TC1_CompareStop();
+        filterMotor.slot_valid = completed;
+        LOG2(LOG_FILTER_STOP, filterMotor.cause, completed);
         
-        SETBYTE_SLOT_SELECTED(SYSTEM_OUT_POSITION); // Sets the OUT OF POSITION on the Status register
-        setFilterError(true);        
+        vTaskNotifyGiveFromISR(motionTask, &woken);
+        portYIELD_FROM_ISR(woken);
         return;
    }
    
-   // If the complete activation has been detected, the activation ends
-   if(completed){
-       stopMotor(_STOP_BECAUSE_TARGET, _CURLIM_LOW);
-       TC1_CompareStop();
-       filterMotor.command_activated = false;            
-       filterMotor.slot_valid = true;       
-       
-       // Sets the current selection on the STATUS register
-        if(filterMotor.target_filter == POSITIONER_SELECT_FILTER1) SETBYTE_SLOT_SELECTED(SYSTEM_FILTER1_SELECTED);
-        else if(filterMotor.target_filter == POSITIONER_SELECT_FILTER2) SETBYTE_SLOT_SELECTED(SYSTEM_FILTER2_SELECTED);
-        else if(filterMotor.target_filter == POSITIONER_SELECT_FILTER3) SETBYTE_SLOT_SELECTED(SYSTEM_FILTER3_SELECTED);
-        else if(filterMotor.target_filter == POSITIONER_SELECT_FILTER4) SETBYTE_SLOT_SELECTED(SYSTEM_FILTER4_SELECTED);
-        else if(filterMotor.target_filter == POSITIONER_SELECT_MIRROR) SETBYTE_SLOT_SELECTED(SYSTEM_MIRROR_SELECTED);
-        else{
-            setFilterError(true);
-            SETBYTE_SLOT_SELECTED(SYSTEM_OUT_POSITION);
-            return;
-        } 
-        setFilterError(false);
-        
-       return;
-   }
-   
    
    
     // Acceleration ramp
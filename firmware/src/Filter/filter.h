@@ -79,12 +79,23 @@
  * Measure of the slider ticks:
  * - Light slots: 1380 steps (18mm);
  * - Dark slots: 130/140 steps;
+ * 
+ * ## Motion task
+ * 
+ * The FilterSelect() forwards the request to the Motion supervisor task
+ * (FilterTask()) through a queue. The task starts the motor and waits
+ * for the notification of the TC1 interrupt at the end of the positioning 
+ * sequence, or for the FILTER_MOTION_TIMEOUT expiration. 
+ * The STATUS and ERROR registers are then updated by the task, 
+ * and the Protocol task is notified to complete the command.
  *  
  *  @{
  * 
  */
     
 
+    #define SLOT_NUMBER     5       //!< Number of slots of the Filter slider
+    
     /**
     * \defgroup filterApiModule Module's API
     *  @{
@@ -94,9 +105,11 @@
     ext void FilterLoop(void);
     ext void FilterTest(void);
     ext bool FilterSelect(uint8_t filter);
+    ext void FilterTask(void* param);
     ext bool FilterIsTarget(uint8_t filter);
     ext bool FilterIsRunning(void);
     ext bool FilterIsError(void);
+    ext bool FilterSetSlotPosition(uint8_t filter, uint16_t position);
     
     /** @}*/ // filterApiModule
     
@@ -141,7 +154,7 @@
         bool    slot_valid;         //!< A valid slot is selected
         uint8_t target_slot;        //!< Target slot selected 
         uint8_t target_filter;      //!< This is the Filter code requested
-        uint32_t target_slot_position[5]; //!< Define the calibrated position for every slot
+        uint32_t target_slot_position[SLOT_NUMBER]; //!< Define the calibrated position for every slot
         
         // Slot detection        
         bool     opto_status; //!< This is a copy of the current Opto status
@@ -174,6 +187,7 @@
     #define FILTER3_SLOT    3
     #define FILTER4_SLOT    4
     #define MIRROR_SLOT     2
+    #define SLOT_INVALID    0xFF    //!< Not valid slot code
 
     
     #define um_step_dimension   ((uint32_t) 13)   //!< (micro-meter) linear space per pulse  
@@ -186,6 +200,10 @@
     #define MAX_STEPS_BETWEEN_SLOTS umToSteps(dark_slot_dim + light_slot_dim) //!< Max number of steps the module shall count between slots
     #define MOTOR_SPEED_HOME _uSTEP_16, 150, 1500, 20 //!< Motor speed: (run-period, init-period, ramp delta-period), with period in us
     #define MOTOR_SPEED_OUT _uSTEP_16, 150, 2000, 20 //!< Motor speed: (run-period, init-period, ramp delta-period), with period in us
+    
+    #define FILTER_TASK_PRIORITY    (tskIDLE_PRIORITY + 3) //!< Motion task priority
+    #define FILTER_TASK_STACK       256                    //!< Motion task stack size (words)
+    #define FILTER_MOTION_TIMEOUT   10000                  //!< Max positioning time (ms)
     /** @}*/ // filterMacroModule
 
     
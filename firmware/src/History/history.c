@@ -0,0 +1,447 @@
+#define _HISTORY_C
+
+#include "application.h"
+#include "history.h"
+#include "Protocol/protocol.h"
+#include "queue.h"
+
+#define HISTORY_KEY_LEN     4       //!< Key record length
+#define HISTORY_DELTA_LEN   2       //!< Delta record length
+#define HISTORY_KEY_FLAG    0x80    //!< Key record marker (byte 0)
+#define HISTORY_DELTA_MAX   15      //!< Max delta of a Delta record
+#define HISTORY_DELTA_MIN   (-16)   //!< Min delta of a Delta record
+#define HISTORY_FRAME_DATA  6       //!< Payload bytes of a stream frame
+#define HISTORY_PAGES       (NVMCTRL_FLASH_BLOCKSIZE / NVMCTRL_FLASH_PAGESIZE) //!< Pages of the snapshot block
+
+static uint8_t  historyBuffer[HISTORY_BUFFER_SIZE]; //!< Records ring buffer
+static uint16_t historyHead;    //!< Next byte to be written
+static uint16_t historyTail;    //!< Oldest byte (always a Key record)
+static uint16_t historyUsed;    //!< Number of stored bytes
+
+/// This is a sample posted by the Thermal task
+typedef struct{
+    int16_t stator;     //!< Stator temperature (0.1C)
+    int16_t bulb;       //!< Bulb temperature (0.1C)
+    uint8_t duty;       //!< Fan duty cycle (%)
+    uint8_t faults;     //!< HISTORY_FAULT_xx flags
+}HISTORY_SAMPLE_t;
+
+static QueueHandle_t sampleQueue = NULL; //!< Samples waiting to be recorded by the HistoryLoop()
+static void historyStore(const HISTORY_SAMPLE_t* sample);
+
+static uint8_t  lastStator;     //!< Last recorded Stator temperature (0.5C)
+static uint8_t  lastBulb;       //!< Last recorded Bulb temperature (0.5C)
+static uint8_t  lastDuty;       //!< Last recorded duty cycle (%)
+static uint8_t  lastFaults;     //!< Last recorded fault flags
+static uint8_t  sampleCount;    //!< Seconds from the last sample
+static uint8_t  keyCount;       //!< Samples from the last Key record
+static uint16_t holdoffCount;   //!< Samples from the last snapshot
+
+static const HISTORY_SNAPSHOT_t* const historySnapshot = (const HISTORY_SNAPSHOT_t*) HISTORY_SNAPSHOT_ADDR; //!< Snapshot flash block
+static uint32_t pageBuffer[NVMCTRL_FLASH_PAGESIZE / 4]; //!< Page image to be written
+static uint8_t  snapshotFaults; //!< Fault flags of the pending snapshot
+static uint8_t  snapshotPage;   //!< Next page to be written
+static enum{
+    SNAPSHOT_IDLE = 0,
+    SNAPSHOT_ERASE,
+    SNAPSHOT_WRITE,
+    SNAPSHOT_COMPLETE,
+}snapshotStatus;
+
+static bool     streamActive;   //!< A stream is in progress
+static uint8_t  streamSource;   //!< Streamed buffer
+static uint16_t streamLength;   //!< Number of data bytes to be streamed
+static uint16_t streamIndex;    //!< Next data byte to be streamed
+static uint16_t streamFrame;    //!< Next frame sequence number
+
+/**
+ * This function returns a data byte of the RAM ring buffer.
+ *
+ * @param i: this is the byte index, starting from the oldest byte
+ * @return the data byte
+ */
+static uint8_t historyByte(uint16_t i){
+    uint32_t idx = (uint32_t) historyTail + i;
+    if(idx >= HISTORY_BUFFER_SIZE) idx -= HISTORY_BUFFER_SIZE;
+    return historyBuffer[idx];
+}
+
+/**
+ * This function discards the oldest Key record with all its Delta records.
+ */
+static void historyDiscard(void){
+    uint8_t len = HISTORY_KEY_LEN;
+
+    do{
+        historyTail += len;
+        if(historyTail >= HISTORY_BUFFER_SIZE) historyTail -= HISTORY_BUFFER_SIZE;
+        historyUsed -= len;
+        if(historyUsed == 0) return;
+        len = (historyBuffer[historyTail] & HISTORY_KEY_FLAG) ? HISTORY_KEY_LEN : HISTORY_DELTA_LEN;
+    }while(len == HISTORY_DELTA_LEN);
+}
+
+/**
+ * This function appends a record to the ring buffer.
+ *
+ * @param rec: this is the record content
+ * @param len: this is the record length
+ */
+static void historyAppend(const uint8_t* rec, uint8_t len){
+    while((HISTORY_BUFFER_SIZE - historyUsed) < len) historyDiscard();
+
+    for(int i = 0; i < len; i++){
+        historyBuffer[historyHead] = rec[i];
+        if(++historyHead >= HISTORY_BUFFER_SIZE) historyHead = 0;
+    }
+    historyUsed += len;
+}
+
+/**
+ * This function calculates the CRC16-CCITT of the RAM ring buffer content.
+ *
+ * @return the calculated CRC
+ */
+static uint16_t historyCrc(void){
+    uint16_t crc = 0xFFFF;
+
+    for(uint16_t i = 0; i < historyUsed; i++){
+        crc ^= ((uint16_t) historyByte(i)) << 8;
+        for(int j = 0; j < 8; j++){
+            if(crc & 0x8000) crc = (crc << 1) ^ 0x1021;
+            else crc = crc << 1;
+        }
+    }
+
+    return crc;
+}
+
+/**
+ * This function verifies the snapshot flash block.
+ *
+ * @return true if the snapshot is valid
+ */
+static bool historySnapshotValid(void){
+    if(historySnapshot->signature != HISTORY_SNAPSHOT_SIGNATURE) return false;
+    if(historySnapshot->version != HISTORY_FORMAT_VERSION) return false;
+    if(historySnapshot->length > HISTORY_BUFFER_SIZE) return false;
+
+    uint16_t crc = 0xFFFF;
+    for(uint16_t i = 0; i < historySnapshot->length; i++){
+        crc ^= ((uint16_t) historySnapshot->data[i]) << 8;
+        for(int j = 0; j < 8; j++){
+            if(crc & 0x8000) crc = (crc << 1) ^ 0x1021;
+            else crc = crc << 1;
+        }
+    }
+
+    return (crc == historySnapshot->crc);
+}
+
+/**
+ * This function prepares the image of a snapshot page.
+ *
+ * The page 0 begins with the snapshot header.
+ * The bytes after the recorded data are left erased (0xFF).
+ *
+ * @param page: this is the page index into the snapshot block
+ */
+static void historyPageImage(uint8_t page){
+    uint8_t* pData = (uint8_t*) pageBuffer;
+    uint16_t i = 0;
+    uint16_t idx = (uint16_t) page * NVMCTRL_FLASH_PAGESIZE;
+
+    if(page == 0){
+        HISTORY_SNAPSHOT_t* pHeader = (HISTORY_SNAPSHOT_t*) pageBuffer;
+        pHeader->signature = HISTORY_SNAPSHOT_SIGNATURE;
+        pHeader->version = HISTORY_FORMAT_VERSION;
+        pHeader->period = HISTORY_SAMPLE_PERIOD;
+        pHeader->length = historyUsed;
+        pHeader->crc = historyCrc();
+        pHeader->faults = snapshotFaults;
+        pHeader->spare = 0xFFFFFFFF;
+        i = HISTORY_HEADER_SIZE;
+    }else idx -= HISTORY_HEADER_SIZE;
+
+    for(; i < NVMCTRL_FLASH_PAGESIZE; i++, idx++){
+        if(idx < historyUsed) pData[i] = historyByte(idx);
+        else pData[i] = 0xFF;
+    }
+}
+
+/**
+ * This function waits the end of the NVM operation in progress.
+ */
+static void historyNvmWait(void){
+    while(NVMCTRL_IsBusy() || NVMCTRL_SmartEEPROM_IsBusy());
+}
+
+/**
+ * This function copies a page of the snapshot block into the active bank.
+ *
+ * @param page: this is the page index into the snapshot block
+ */
+static void historyPageMigrate(uint8_t page){
+    const uint32_t* pSource = (const uint32_t*) (HISTORY_SNAPSHOT_ADDR + (uint32_t) page * NVMCTRL_FLASH_PAGESIZE);
+
+    for(int i = 0; i < NVMCTRL_FLASH_PAGESIZE / 4; i++) pageBuffer[i] = pSource[i];
+
+    historyNvmWait();
+    NVMCTRL_PageWrite(pageBuffer, HISTORY_SNAPSHOT_SWAP_ADDR + (uint32_t) page * NVMCTRL_FLASH_PAGESIZE);
+}
+
+/**
+ * This function sends the next stream frame.
+ *
+ * The frame is sent only if the CAN0 Tx FIFO is free.
+ */
+static void historyStreamFrame(void){
+    uint8_t frame[8];
+    uint16_t idx = streamIndex;
+
+    if(CAN0_TxFIFOIsFull()) return;
+
+    frame[0] = (uint8_t) streamFrame;
+    frame[1] = (uint8_t) (streamFrame >> 8);
+
+    if(streamFrame == 0){
+        frame[2] = HISTORY_FORMAT_VERSION;
+        frame[3] = (streamSource == HISTORY_SOURCE_FLASH) ? historySnapshot->period : HISTORY_SAMPLE_PERIOD;
+        frame[4] = (uint8_t) streamLength;
+        frame[5] = (uint8_t) (streamLength >> 8);
+        frame[6] = streamSource;
+        frame[7] = 0;
+    }else{
+        for(int i = 0; i < HISTORY_FRAME_DATA; i++){
+            if(idx >= streamLength) frame[2 + i] = 0;
+            else if(streamSource == HISTORY_SOURCE_FLASH) frame[2 + i] = historySnapshot->data[idx++];
+            else frame[2 + i] = historyByte(idx++);
+        }
+    }
+
+    if(!CAN0_MessageTransmit(HISTORY_STREAM_CAN_ID, 8, frame, CAN_MODE_NORMAL, CAN_MSG_ATTR_TX_FIFO_DATA_FRAME)) return;
+    streamFrame++;
+    streamIndex = idx;
+    if(streamIndex >= streamLength) streamActive = false;
+}
+
+/**
+ * Module initialization.
+ *
+ * The RAM ring buffer is cleared: the first recorded sample is a Key record.
+ */
+void HistoryInit(void){
+    historyHead = 0;
+    historyTail = 0;
+    historyUsed = 0;
+    sampleCount = 0;
+    keyCount = 0;
+    holdoffCount = HISTORY_SNAPSHOT_HOLDOFF;
+    lastFaults = 0;
+    snapshotStatus = SNAPSHOT_IDLE;
+    streamActive = false;
+    sampleQueue = xQueueCreate(HISTORY_SAMPLE_QUEUE_LEN, sizeof(HISTORY_SAMPLE_t));
+}
+
+/**
+ * This function shall be called by the Protocol task.
+ *
+ * The function records the posted samples, sends the next stream frame and
+ * proceeds with the snapshot writing.
+ */
+void HistoryLoop(void){
+    HISTORY_SAMPLE_t sample;
+
+    while(xQueueReceive(sampleQueue, &sample, 0) == pdTRUE) historyStore(&sample);
+    if(streamActive) historyStreamFrame();
+
+    if(snapshotStatus == SNAPSHOT_IDLE) return;
+    if(NVMCTRL_IsBusy() || NVMCTRL_SmartEEPROM_IsBusy()) return;
+
+    switch(snapshotStatus){
+        case SNAPSHOT_ERASE:
+            NVMCTRL_BlockErase(HISTORY_SNAPSHOT_ADDR);
+            snapshotPage = 1;
+            snapshotStatus = SNAPSHOT_WRITE;
+            break;
+
+        case SNAPSHOT_WRITE:
+            // The header page is written as last
+            historyPageImage(snapshotPage);
+            NVMCTRL_PageWrite(pageBuffer, HISTORY_SNAPSHOT_ADDR + (uint32_t) snapshotPage * NVMCTRL_FLASH_PAGESIZE);
+            if(snapshotPage == 0) snapshotStatus = SNAPSHOT_COMPLETE;
+            else if(++snapshotPage >= HISTORY_PAGES) snapshotPage = 0;
+            break;
+
+        default:
+            snapshotStatus = SNAPSHOT_IDLE;
+    }
+}
+
+/**
+ * This function stores a sample into the ring buffer.
+ *
+ * One sample every HISTORY_SAMPLE_PERIOD calls is stored.
+ *
+ * A new fault flag starts the snapshot of the buffer
+ * (the recording is suspended until the snapshot completion).
+ *
+ * @param sample: this is the sample posted by HistoryRecord()
+ */
+static void historyStore(const HISTORY_SAMPLE_t* sample){
+    uint8_t rec[HISTORY_KEY_LEN];
+    int16_t stator = sample->stator;
+    int16_t bulb = sample->bulb;
+    uint8_t duty = sample->duty;
+    uint8_t faults = sample->faults;
+
+    if(streamActive || (snapshotStatus != SNAPSHOT_IDLE)) return;
+
+    bool newFault = ((faults & ~lastFaults) != 0);
+    if((++sampleCount < HISTORY_SAMPLE_PERIOD) && (faults == lastFaults)) return;
+    sampleCount = 0;
+    if(holdoffCount < HISTORY_SNAPSHOT_HOLDOFF) holdoffCount++;
+
+    // Temperatures in 0.5C units
+    if(stator < 0) stator = 0;
+    if(bulb < 0) bulb = 0;
+    uint8_t st = (stator >= 1275) ? 255 : (uint8_t) ((stator + 2) / 5);
+    uint8_t bl = (bulb >= 1275) ? 255 : (uint8_t) ((bulb + 2) / 5);
+    if(duty > 100) duty = 100;
+
+    int16_t dst = (int16_t) st - lastStator;
+    int16_t dbl = (int16_t) bl - lastBulb;
+    int16_t ddt = (int16_t) duty - lastDuty;
+
+    if((historyUsed == 0) || (++keyCount >= HISTORY_KEY_INTERVAL) || (faults != lastFaults) ||
+       (dst > HISTORY_DELTA_MAX) || (dst < HISTORY_DELTA_MIN) ||
+       (dbl > HISTORY_DELTA_MAX) || (dbl < HISTORY_DELTA_MIN) ||
+       (ddt > HISTORY_DELTA_MAX) || (ddt < HISTORY_DELTA_MIN)){
+
+        rec[0] = HISTORY_KEY_FLAG | faults;
+        rec[1] = st;
+        rec[2] = bl;
+        rec[3] = duty;
+        historyAppend(rec, HISTORY_KEY_LEN);
+        keyCount = 0;
+    }else{
+        uint16_t delta = (((uint16_t) dst & 0x1F) << 10) | (((uint16_t) dbl & 0x1F) << 5) | ((uint16_t) ddt & 0x1F);
+        rec[0] = (uint8_t) (delta >> 8);
+        rec[1] = (uint8_t) delta;
+        historyAppend(rec, HISTORY_DELTA_LEN);
+    }
+
+    lastStator = st;
+    lastBulb = bl;
+    lastDuty = duty;
+    lastFaults = faults;
+
+    if(newFault && (holdoffCount >= HISTORY_SNAPSHOT_HOLDOFF)){
+        holdoffCount = 0;
+        snapshotFaults = faults;
+        snapshotStatus = SNAPSHOT_ERASE;
+    }
+}
+
+/**
+ * This function records the temperatures and the duty cycle.
+ *
+ * The function shall be called every second by the Thermal task:
+ * the sample is posted to the HistoryLoop(), so the ring buffer
+ * is accessed only by the Protocol task.
+ *
+ * @param stator: this is the Stator temperature (0.1C)
+ * @param bulb: this is the Bulb temperature (0.1C)
+ * @param duty: this is the Fan duty cycle (%)
+ * @param faults: this is the combination of the HISTORY_FAULT_xx flags
+ */
+void HistoryRecord(int16_t stator, int16_t bulb, uint8_t duty, uint8_t faults){
+    HISTORY_SAMPLE_t sample = {stator, bulb, duty, faults};
+
+    xQueueSend(sampleQueue, &sample, 0);
+}
+
+/**
+ * This function starts the stream of a history buffer.
+ *
+ * @param source: this is the streamed buffer (HISTORY_SOURCE_RAM or HISTORY_SOURCE_FLASH)
+ * @return true if the stream is started
+ */
+bool HistoryStreamStart(uint8_t source){
+    if(streamActive) return false;
+
+    if(source == HISTORY_SOURCE_RAM){
+        streamLength = historyUsed;
+    }else if(source == HISTORY_SOURCE_FLASH){
+        if(snapshotStatus != SNAPSHOT_IDLE) return false;
+        if(!historySnapshotValid()) return false;
+        streamLength = historySnapshot->length;
+    }else return false;
+
+    streamSource = source;
+    streamIndex = 0;
+    streamFrame = 0;
+    streamActive = true;
+    return true;
+}
+
+/**
+ * This function aborts the stream in progress.
+ */
+void HistoryStreamStop(void){
+    streamActive = false;
+}
+
+/**
+ * This function returns the stream activity status.
+ *
+ * @return true if the stream is in progress
+ */
+bool HistoryIsStreaming(void){
+    return streamActive;
+}
+
+/**
+ * This function returns the module activity status.
+ *
+ * @return true if a stream or a snapshot is in progress
+ */
+bool HistoryIsBusy(void){
+    return streamActive || (snapshotStatus != SNAPSHOT_IDLE);
+}
+
+/**
+ * This function returns the data length of the last stream.
+ *
+ * @return the number of streamed data bytes
+ */
+uint16_t HistoryStreamLength(void){
+    return streamLength;
+}
+
+/**
+ * This function prepares the snapshot for a bank swap.
+ *
+ * The block at HISTORY_SNAPSHOT_SWAP_ADDR (active bank) is erased
+ * and the valid snapshot is copied into it, the header page as last:
+ * after the NVMCTRL_BankSwap() the block is mapped at HISTORY_SNAPSHOT_ADDR.
+ * Without a valid snapshot the block is only erased.
+ *
+ * The function shall be called just before the swap, with no snapshot or stream
+ * in progress (see HistoryIsBusy()), also before the HistoryInit().
+ * The function returns when the copy is completed: the active bank is written,
+ * so the CPU is stalled during every NVM operation.
+ */
+void HistorySnapshotMigrate(void){
+    bool valid = historySnapshotValid();
+
+    historyNvmWait();
+    NVMCTRL_BlockErase(HISTORY_SNAPSHOT_SWAP_ADDR);
+
+    if(valid){
+        for(uint8_t page = 1; page < HISTORY_PAGES; page++) historyPageMigrate(page);
+        historyPageMigrate(0);
+    }
+
+    historyNvmWait();
+}
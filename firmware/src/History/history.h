@@ -0,0 +1,164 @@
+#ifndef _HISTORY_H
+#define _HISTORY_H
+
+#include "definitions.h"
+#include "application.h"
+
+#undef ext
+#undef ext_static
+
+#ifdef _HISTORY_C
+    #define ext
+    #define ext_static static
+#else
+    #define ext extern
+    #define ext_static extern
+#endif
+
+/*!
+ * \defgroup historyModule Temperature history module
+ *
+ * \ingroup applicationModule
+ *
+ *
+ * This Module records the Stator temperature, the Bulb temperature and
+ * the Fan duty cycle in a RAM ring buffer, so that the thermal
+ * behavior of the tube in the last hours can be downloaded by the Host.
+ *
+ * ## Dependencies
+ *
+ * - NVMCTRL module (block erase and page write);
+ * - CAN0 module (stream frames);
+ *
+ * ## Linker setting
+ *
+ * The application ROM fits a single bank (ROM_LENGTH = 0x76000, see \ref updateModule):
+ * the 8KB block at HISTORY_SNAPSHOT_ADDR, at the top of the inactive bank just below
+ * the SmartEEPROM sectors, is reserved to the history snapshot.
+ * The same block of the active bank (HISTORY_SNAPSHOT_SWAP_ADDR) is reserved too:
+ * it is mapped at HISTORY_SNAPSHOT_ADDR after a bank swap.
+ *
+ * ## Module Function Description
+ *
+ * ### Recording
+ *
+ * HistoryRecord() is called by the XrayLoop() every second and
+ * one sample every HISTORY_SAMPLE_PERIOD seconds is stored.
+ * The samples are posted by the Thermal task through a queue:
+ * the buffer is accessed only by the HistoryLoop() in the Protocol task.
+ * The temperatures are stored in 0.5C units and the duty cycle in %.
+ *
+ * The samples are delta encoded:
+ * - Key record (4 bytes): byte 0 = 0x80 | fault flags,
+ *   byte 1 = Stator temperature, byte 2 = Bulb temperature, byte 3 = duty cycle;
+ * - Delta record (2 bytes, big endian): bit 15 = 0, bits 14..10 Stator delta,
+ *   bits 9..5 Bulb delta, bits 4..0 duty cycle delta (5 bit two's complement).
+ *
+ * A Key record is stored every HISTORY_KEY_INTERVAL samples, when a delta
+ * is out of range or when the fault flags change. When the ring buffer is full
+ * the oldest Key record is discarded with all its Delta records,
+ * so the buffer always starts with a Key record.
+ *
+ * With a steady temperature the buffer holds more than 11 hours.
+ *
+ * ### Error snapshot
+ *
+ * When a new sensor error (fault or high temperature) is notified, the buffer content is copied
+ * into the reserved flash block (at most once every HISTORY_SNAPSHOT_HOLDOFF samples
+ * to limit the flash wear). The block is erased and written one page per HistoryLoop() call
+ * (the block is in the flash bank not executing the code): the header page is written last,
+ * so an interrupted snapshot is discarded by the CRC check.
+ *
+ * The NVMCTRL_BankSwap() of the \ref updateModule exchanges the two banks, so after the swap
+ * HISTORY_SNAPSHOT_ADDR would show the block left in the other bank by an older image,
+ * with a valid CRC. Before every swap HistorySnapshotMigrate() erases the block at
+ * HISTORY_SNAPSHOT_SWAP_ADDR and copies the valid snapshot into it (the header page last):
+ * the snapshot survives the swap and a stale one is never restored.
+ *
+ * ### Download
+ *
+ * The GET_TEMPERATURE_HISTORY command (d0 = HISTORY_SOURCE_RAM or HISTORY_SOURCE_FLASH)
+ * starts the stream of the selected buffer on the HISTORY_STREAM_CAN_ID frames:
+ * - bytes 0,1: frame sequence number (little endian);
+ * - bytes 2..7: payload.
+ *
+ * The frame 0 payload is the stream header: format version, sample period (s),
+ * data length (little endian), source and 0; the next frames carry the data bytes
+ * (the last frame is padded with 0).
+ *
+ * A frame is sent by the HistoryLoop() only when the CAN0 Tx FIFO is free,
+ * after the protocol loop has been served (see ApplicationProtocolTask()). The command completes with
+ * the data length when the last frame is sent. During the stream
+ * and the snapshot the recording is suspended.
+ *
+ *  @{
+ *
+ */
+
+     /**
+    * \defgroup historyApiModule API Module
+    *  @{
+    */
+
+        ext void HistoryInit(void);
+        ext void HistoryLoop(void);
+        ext void HistoryRecord(int16_t stator, int16_t bulb, uint8_t duty, uint8_t faults);
+        ext bool HistoryStreamStart(uint8_t source);
+        ext void HistoryStreamStop(void);
+        ext bool HistoryIsStreaming(void);
+        ext bool HistoryIsBusy(void);
+        ext uint16_t HistoryStreamLength(void);
+        ext void HistorySnapshotMigrate(void);
+
+    /** @}*/ // historyApiModule
+
+    /**
+    * \defgroup historyMacroModule Module's Macros
+    *  @{
+    */
+
+        #define HISTORY_SAMPLE_PERIOD       10          //!< Sample period (s)
+        #define HISTORY_KEY_INTERVAL        60          //!< Max number of samples between two Key records
+        #define HISTORY_SNAPSHOT_HOLDOFF    360         //!< Min number of samples between two snapshots (1 hour)
+        #define HISTORY_FORMAT_VERSION      1           //!< Record format version
+        #define HISTORY_SAMPLE_QUEUE_LEN    4           //!< Max number of samples waiting to be recorded
+
+        #define HISTORY_FAULT_STATOR        0x1         //!< Stator sensor fault or high temperature flag
+        #define HISTORY_FAULT_BULB          0x2         //!< Bulb sensor fault or high temperature flag
+
+        #define HISTORY_SOURCE_RAM          0           //!< GET_TEMPERATURE_HISTORY d0: RAM ring buffer
+        #define HISTORY_SOURCE_FLASH        1           //!< GET_TEMPERATURE_HISTORY d0: last error snapshot
+
+        #define HISTORY_STREAM_CAN_ID       (0x580 + MET_CAN_APP_DEVICE_ID) //!< CAN Id of the stream frames
+
+        #define HISTORY_SNAPSHOT_ADDR       0xFA000     //!< Snapshot flash block address
+        #define HISTORY_SNAPSHOT_SWAP_ADDR  (HISTORY_SNAPSHOT_ADDR - 0x80000) //!< Same block in the active bank: mapped at HISTORY_SNAPSHOT_ADDR after a bank swap
+        #define HISTORY_SNAPSHOT_SIGNATURE  0x4854      //!< Snapshot signature
+        #define HISTORY_HEADER_SIZE         16          //!< Snapshot header size
+        #define HISTORY_BUFFER_SIZE         (NVMCTRL_FLASH_BLOCKSIZE - HISTORY_HEADER_SIZE) //!< Ring buffer size: header and buffer fill a flash block
+
+    /** @}*/ // historyMacroModule
+
+     /**
+    * \defgroup historyStructModule Module Data structures
+    *  @{
+    */
+
+    /// This is the image of the snapshot flash block
+    typedef struct{
+        uint16_t signature; //!< Snapshot signature (HISTORY_SNAPSHOT_SIGNATURE)
+        uint8_t  version;   //!< Record format version (HISTORY_FORMAT_VERSION)
+        uint8_t  period;    //!< Sample period (s)
+        uint16_t length;    //!< Number of stored data bytes
+        uint16_t crc;       //!< CRC16-CCITT of the stored data bytes
+        uint32_t faults;    //!< Fault flags triggering the snapshot
+        uint32_t spare;
+        uint8_t  data[HISTORY_BUFFER_SIZE]; //!< History records, oldest first
+    }HISTORY_SNAPSHOT_t;
+
+    /** @}*/ // historyStructModule
+
+/** @}*/ // historyModule
+
+
+#endif
@@ -0,0 +1,177 @@
+#define _LOG_C
+
+#include "application.h"
+#include "log.h"
+
+static uint8_t logBuffer[LOG_BUFFER_SIZE] __ALIGNED(4);    //!< Records ring buffer
+static volatile uint32_t logState = 0;      //!< Writers state word (see LOG_STATE())
+static volatile uint32_t logTail = 0;       //!< First byte not yet transmitted
+static volatile uint32_t logTransfer = 0;   //!< Size of the DMAC transfer in progress
+static volatile uint32_t logOwner = 0;      //!< 1 = the DMAC channel is owned by a transfer
+static volatile bool logStarted = false;    //!< At least a transfer has been started
+
+static void logDrain(void);
+
+/**
+ * This function acquires the DMAC channel.
+ *
+ * @return false if the channel is already owned
+ */
+static bool logAcquire(void){
+    do{
+        if(__LDREXW(&logOwner)){
+            __CLREX();
+            return false;
+        }
+    }while(__STREXW(1, &logOwner));
+
+    __DMB();
+    return true;
+}
+
+/**
+ * This function releases the DMAC channel.
+ */
+static void logRelease(void){
+    __DMB();
+    logOwner = 0;
+}
+
+/**
+ * This is the DMAC channel 2 transfer complete callback (interrupt).
+ *
+ * The transmitted bytes are released and the next transfer is started.
+ * After an error the transfer is discarded: the host decoder
+ * resynchronizes on the next record.
+ */
+static void logDmacCallback(DMAC_TRANSFER_EVENT event, uintptr_t context){
+    logTail = (logTail + logTransfer) & LOG_INDEX_MASK;
+    logRelease();
+    logDrain();
+}
+
+/**
+ * This function starts the transmission of the published records.
+ *
+ * The function returns immediately if a transfer is in progress:
+ * the transfer complete callback calls the function again.
+ * The transfer ends at the published index or at the end of the buffer.
+ */
+static void logDrain(void){
+    uint32_t published, tail;
+
+    while(true){
+        if(!logAcquire()) return;
+
+        tail = logTail;
+        published = LOG_PUBLISHED(logState);
+        if(published != tail) break;
+
+        // A record can be published by an interrupt before the release:
+        // its writer has found the channel owned
+        logRelease();
+        if(LOG_PUBLISHED(logState) == logTail) return;
+    }
+
+    logTransfer = ((published > tail) ? published : LOG_BUFFER_SIZE) - tail;
+    logStarted = true;
+    DMAC_ChannelTransfer(LOG_DMAC_CHANNEL, &logBuffer[tail], (const void*) &SERCOM5_REGS->USART_INT.SERCOM_DATA, logTransfer);
+}
+
+/**
+ * This function initializes the module.
+ *
+ * The function shall be called after the SYS_Initialize(),
+ * before any log statement.
+ */
+void LogInit(void){
+    logState = 0;
+    logTail = 0;
+    logTransfer = 0;
+    logOwner = 0;
+    logStarted = false;
+
+    DMAC_ChannelCallbackRegister(LOG_DMAC_CHANNEL, logDmacCallback, 0);
+    LOG1(LOG_BOOT, RSTC_REGS->RSTC_RCAUSE);
+}
+
+/**
+ * This function writes a log record.
+ *
+ * The function can be called by any task or interrupt routine:
+ * the record is reserved and published without disabling the interrupts
+ * (see the module description).
+ *
+ * @param id: this is the format identifier
+ * @param count: this is the number of arguments (max LOG_MAX_ARGS)
+ * @param arg0 .. arg3: these are the arguments (the arguments beyond count are not written)
+ * @return false if the buffer is full and the record has been dropped
+ */
+bool LogWrite(LOG_FORMAT_ENUM_t id, uint8_t count, uint32_t arg0, uint32_t arg1, uint32_t arg2, uint32_t arg3){
+    uint32_t args[LOG_MAX_ARGS] = {arg0, arg1, arg2, arg3};
+    uint32_t stamp = DWT->CYCCNT;
+    uint32_t state, next, head, size, writers;
+    uint8_t sequence;
+    bool reserved;
+
+    if(count > LOG_MAX_ARGS) count = LOG_MAX_ARGS;
+    size = LOG_RECORD_SIZE(count);
+
+    // Reservation: the sequence number is incremented also if the record is dropped
+    do{
+        state = __LDREXW(&logState);
+        head = LOG_HEAD(state);
+        sequence = (uint8_t) LOG_SEQUENCE(state);
+        reserved = (((head - logTail) & LOG_INDEX_MASK) + size < LOG_BUFFER_SIZE);
+        if(reserved) next = LOG_STATE(head + size, LOG_PUBLISHED(state), LOG_WRITERS(state) + 1, sequence + 1);
+        else next = LOG_STATE(head, LOG_PUBLISHED(state), LOG_WRITERS(state), sequence + 1);
+    }while(__STREXW(next, &logState));
+
+    if(!reserved) return false;
+
+    // Record copy
+    uint8_t record[LOG_RECORD_SIZE(LOG_MAX_ARGS)];
+    uint8_t checksum = 0;
+    uint32_t i = 0;
+
+    record[i++] = LOG_SYNC;
+    record[i++] = (uint8_t) id;
+    record[i++] = sequence;
+    record[i++] = count;
+    for(int b = 0; b < 32; b += 8) record[i++] = (uint8_t) (stamp >> b);
+    for(int a = 0; a < count; a++){
+        for(int b = 0; b < 32; b += 8) record[i++] = (uint8_t) (args[a] >> b);
+    }
+    for(uint32_t j = 1; j < i; j++) checksum += record[j];
+    record[i++] = (uint8_t) -checksum;
+
+    uint32_t first = LOG_BUFFER_SIZE - head;
+    if(first >= size) memcpy(&logBuffer[head], record, size);
+    else{
+        memcpy(&logBuffer[head], record, first);
+        memcpy(logBuffer, &record[first], size - first);
+    }
+    __DMB();
+
+    // Release: the last writer publishes all the reserved records
+    do{
+        state = __LDREXW(&logState);
+        writers = LOG_WRITERS(state) - 1;
+        next = LOG_STATE(LOG_HEAD(state), (writers) ? LOG_PUBLISHED(state) : LOG_HEAD(state), writers, LOG_SEQUENCE(state));
+    }while(__STREXW(next, &logState));
+
+    if(writers == 0) logDrain();
+    return true;
+}
+
+/**
+ * This function tests if the log is transmitting.
+ *
+ * @return true if records are waiting or the last byte is being shifted out
+ */
+bool LogIsBusy(void){
+    if(logOwner) return true;
+    if(LOG_PUBLISHED(logState) != logTail) return true;
+    if(logStarted && !SERCOM5_USART_TransmitComplete()) return true;
+    return false;
+}
@@ -0,0 +1,134 @@
+#ifndef _LOG_H
+#define _LOG_H
+
+#include "definitions.h"
+#include "application.h"
+#include "log_formats.h"
+
+#undef ext
+#undef ext_static
+
+#ifdef _LOG_C
+    #define ext
+    #define ext_static static
+#else
+    #define ext extern
+    #define ext_static extern
+#endif
+
+/*!
+ * \defgroup logModule Binary diagnostic log module
+ *
+ * \ingroup applicationModule
+ *
+ *
+ * This Module sends the diagnostic log records to a serial port
+ * without formatting the text on the device.
+ *
+ * ## Dependencies
+ *
+ * - SERCOM5 USART: TX only on PB02 (PAD0), 2Mbaud 8N1;
+ * - DMAC channel 2: SERCOM5 TX trigger, transfer complete interrupt;
+ * - DWT unit of the Cortex-M4 core (CYCCNT register, started by the \ref bootModule);
+ *
+ * ## Records
+ *
+ * A log statement (LOG0() to LOG4() macros) writes a binary record:
+ * the format identifier, a sequence number, the cycle counter and up to
+ * LOG_MAX_ARGS 32 bit arguments (see Log/log_formats.h for the layout).
+ * The text is never formatted on the device: the host decoder (tools/log_decoder)
+ * rebuilds it from the same format table (LOG_FORMATS() list).
+ *
+ * A record with 4 arguments takes 25 bytes (125us at 2Mbaud):
+ * the log statement takes a few hundred CPU cycles and can be used
+ * in the interrupt routines, as the motor step callback.
+ *
+ * ## Lock-free buffer
+ *
+ * The records are written in a LOG_BUFFER_SIZE bytes ring buffer
+ * by any task or interrupt routine, without disabling the interrupts.
+ * The writers share one state word, updated with the exclusive access instructions (LDREX/STREX):
+ * - the head index, where the next record is reserved;
+ * - the published index, the end of the records completely written;
+ * - the number of writers between the reservation and the completion of a record;
+ * - the sequence number of the next record.
+ *
+ * A writer reserves the record space moving the head index, copies the record and
+ * releases the reservation: the last writer leaving publishes all the reserved records.
+ * A writer interrupted by another writer completes its record after the interrupt:
+ * the records of both are published together.
+ *
+ * If the buffer is full the record is dropped: the sequence number is incremented anyway,
+ * so the host decoder reports the number of records lost.
+ *
+ * ## DMA transmission
+ *
+ * The published records are transmitted by the DMAC channel 2 (one byte every SERCOM5 DRE trigger),
+ * from the transmitted index to the published index or to the end of the buffer.
+ * The transfer complete interrupt releases the transmitted space and starts the next transfer.
+ * The last writer publishing the records starts the transfer if the channel is idle.
+ *
+ * The CPU never waits the serial port: the log statement cost doesn't depend
+ * on the UART baudrate. The STANDBY is delayed until the buffer is empty (see \ref powerSaveModule).
+ *
+ *  @{
+ *
+ */
+
+     /**
+    * \defgroup logStructModule Module Data structures
+    *  @{
+    */
+
+    #define LOG_ID(id, text) id,
+
+    /// This is the list of the log formats (see LOG_FORMATS())
+    typedef enum{
+        LOG_FORMATS(LOG_ID)
+        LOG_FORMATS_NUM         //!< Number of the formats (not a format)
+    }LOG_FORMAT_ENUM_t;
+
+    #undef LOG_ID
+
+    /** @}*/ // logStructModule
+
+     /**
+    * \defgroup logApiModule API Module
+    *  @{
+    */
+
+        ext void LogInit(void);
+        ext bool LogWrite(LOG_FORMAT_ENUM_t id, uint8_t count, uint32_t arg0, uint32_t arg1, uint32_t arg2, uint32_t arg3);
+        ext bool LogIsBusy(void);
+
+    /** @}*/ // logApiModule
+
+    /**
+    * \defgroup logMacroModule Module's Macros
+    *  @{
+    */
+
+        #define LOG0(id)                LogWrite(id, 0, 0, 0, 0, 0)                                                 //!< Log record without arguments
+        #define LOG1(id,a)              LogWrite(id, 1, (uint32_t) (a), 0, 0, 0)                                    //!< Log record with 1 argument
+        #define LOG2(id,a,b)            LogWrite(id, 2, (uint32_t) (a), (uint32_t) (b), 0, 0)                       //!< Log record with 2 arguments
+        #define LOG3(id,a,b,c)          LogWrite(id, 3, (uint32_t) (a), (uint32_t) (b), (uint32_t) (c), 0)          //!< Log record with 3 arguments
+        #define LOG4(id,a,b,c,d)        LogWrite(id, 4, (uint32_t) (a), (uint32_t) (b), (uint32_t) (c), (uint32_t) (d)) //!< Log record with 4 arguments
+
+        #define LOG_DMAC_CHANNEL        DMAC_CHANNEL_2      //!< DMAC channel of the SERCOM5 TX
+        #define LOG_BUFFER_SIZE         1024                //!< Ring buffer size (bytes): power of 2, max 1024 (state word fields)
+        #define LOG_INDEX_MASK          (LOG_BUFFER_SIZE - 1)
+
+        // State word fields: head (bits 0..9), published (bits 10..19), writers (bits 20..23), sequence (bits 24..31)
+        #define LOG_HEAD(state)         ((state) & 0x3FF)
+        #define LOG_PUBLISHED(state)    (((state) >> 10) & 0x3FF)
+        #define LOG_WRITERS(state)      (((state) >> 20) & 0xF)
+        #define LOG_SEQUENCE(state)     ((state) >> 24)
+        #define LOG_STATE(head, published, writers, sequence) \
+            (((head) & 0x3FF) | (((published) & 0x3FF) << 10) | (((writers) & 0xF) << 20) | (((sequence) & 0xFF) << 24))
+
+    /** @}*/ // logMacroModule
+
+/** @}*/ // logModule
+
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef _LOG_FORMATS_H
+#define _LOG_FORMATS_H
+
+/*
+ * Binary log record layout and format table (see Log/log.h)
+ *
+ * This file is shared with the host decoder (tools/log_decoder):
+ * it shall not include any firmware header.
+ *
+ * Record layout (multi byte fields little endian):
+ * - byte 0: LOG_SYNC;
+ * - byte 1: format identifier (LOG_xx);
+ * - byte 2: sequence number (modulo 256, dropped records included);
+ * - byte 3: number of arguments (0 to LOG_MAX_ARGS);
+ * - bytes 4..7: DWT cycle counter at the log call;
+ * - 4 bytes for every argument;
+ * - last byte: checksum, the sum of the bytes from the identifier to the checksum is 0 (modulo 256).
+ *
+ * A format is added at the end of LOG_FORMATS(): the identifiers are its position in the list.
+ * The text is a printf() format: every conversion takes a 32 bit argument (%u, %d, %x).
+ */
+
+#define LOG_SYNC                0xA5        //!< First byte of a record
+#define LOG_MAX_ARGS            4           //!< Max number of arguments of a record
+#define LOG_HEADER_SIZE         8           //!< Record size before the arguments
+#define LOG_RECORD_SIZE(args)   (LOG_HEADER_SIZE + 4 * (args) + 1)  //!< Record size with the given arguments
+
+#define LOG_FORMATS(X) \
+    X(LOG_BOOT,             "Log started: reset cause 0x%02x") \
+    X(LOG_FILTER_START,     "Filter start: code %u slot %u") \
+    X(LOG_FILTER_STEP,      "Filter step: sequence %u opto %u pulses %u period %u") \
+    X(LOG_FILTER_STOP,      "Filter stop: cause %u slot valid %u") \
+    X(LOG_FILTER_TIMEOUT,   "Filter timeout: sequence %u")
+
+#endif
@@ -4,39 +4,69 @@
 #include "power_led.h"
 #include "Protocol/protocol.h" 
 
-static int light_tmo = 0;
+static volatile bool light_expired = false; //!< The timeout has switched Off the light (set into the RTC interrupt)
 
 void PowerLedInit(void){
+    RTC_Timer32InterruptDisable(RTC_TIMER32_INT_MASK_CMP0);
     uc_POWERLED_Clear();
     SETBIT_FLAGS_LIGHT_ON(false);
-    light_tmo = 0;
+    light_expired = false;
     
 }
 
 /**
- * This routine is called every 15ms
+ * This routine shall be called by the Protocol task.
+ * 
+ * The function updates the light status flag 
+ * after the timeout expiration.
  */
 void PowerLedLoop(void){
     
-    if(light_tmo){
-        light_tmo--;
-        if(light_tmo == 0){
-            SETBIT_FLAGS_LIGHT_ON(false);
-            uc_POWERLED_Clear();
-        }
+    if(light_expired){
+        light_expired = false;
+        SETBIT_FLAGS_LIGHT_ON(false);
     }
 }
 
+/**
+ * This routine shall be called by the RTC interrupt 
+ * on the COMP0 match event.
+ * 
+ * The light is switched Off at the exact timeout expiration:
+ * the status flag is updated by the PowerLedLoop().
+ */
+void PowerLedTimeoutEvent(void){
+    RTC_Timer32InterruptDisable(RTC_TIMER32_INT_MASK_CMP0);
+    uc_POWERLED_Clear();
+    light_expired = true;
+}
+
 void PowerLedOff(void){    
+    RTC_Timer32InterruptDisable(RTC_TIMER32_INT_MASK_CMP0);
     uc_POWERLED_Clear();
     SETBIT_FLAGS_LIGHT_ON(false);
-    light_tmo = 0;
+    light_expired = false;
 }
 
+/**
+ * This function switches On the light.
+ * 
+ * The light timeout (PROTO_PARAM_LIGHT_TIMEOUT, in seconds) is scheduled 
+ * on the RTC COMP0 register: the compare match interrupt 
+ * switches the light Off (see PowerLedTimeoutEvent()).
+ * A timeout of 0 keeps the light On.
+ */
 void PowerLedOn(void){
+    RTC_Timer32InterruptDisable(RTC_TIMER32_INT_MASK_CMP0);
+    light_expired = false;
+    
     uc_POWERLED_Set();
-    light_tmo = (int) GETBYTE_PARAMETER_LIGHT_TIMEOUT * (int) 66; // 15ms to seconds
     SETBIT_FLAGS_LIGHT_ON(true);
     
+    if(GETBYTE_PARAMETER_LIGHT_TIMEOUT == 0) return;
+    
+    RTC_Timer32Compare0Set(RTC_Timer32CounterGet() + (uint32_t) GETBYTE_PARAMETER_LIGHT_TIMEOUT * RTC_COUNTER_CLOCK_FREQUENCY);
+    RTC_REGS->MODE0.RTC_INTFLAG = RTC_MODE0_INTFLAG_CMP0_Msk;
+    RTC_Timer32InterruptEnable(RTC_TIMER32_INT_MASK_CMP0);
 }
 
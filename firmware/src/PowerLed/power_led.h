@@ -38,6 +38,10 @@
  * 
  * ## Module Function Description
  *  
+ * The light timeout is a one-shot deadline on the RTC counter (1024Hz):
+ * PowerLedOn() programs the RTC COMP0 register and the compare match 
+ * interrupt switches the light Off exactly at the timeout expiration,
+ * without any periodic countdown.
  * 
  *  @{
  * 
@@ -52,6 +56,7 @@
     
         
         ext void PowerLedLoop(void);
+        ext void PowerLedTimeoutEvent(void);
         
         ext void PowerLedOff(void);
         ext void PowerLedOn(void);
@@ -0,0 +1,246 @@
+#define _POWER_SAVE_C
+
+#include "application.h"
+#include "power_save.h"
+#include "Protocol/protocol.h"
+#include "Filter/filter.h"
+#include "XrayTube/xray_tube.h"
+#include "Storage/storage.h"
+#include "History/history.h"
+#include "Update/update.h"
+#include "Log/log.h"
+
+#define CAN_RX_WAKE_MASK    (1UL << POWER_CAN_RX_EXTINT)
+#define OPTO_WAKE_MASK      (1UL << POWER_OPTO_EXTINT)
+
+static volatile uint8_t powerMode = POWER_MODE_IDLE;    //!< Current power mode (PROTO_PARAM_POWER_MODE)
+static volatile uint8_t wakeSource = 0;                 //!< Last wake-up source (POWER_WAKE_xx)
+static volatile bool wakePending = false;               //!< A CAN wake-up latency shall be measured
+static volatile uint32_t wakeTime = 0;                  //!< Run time counter at the STANDBY exit
+static volatile uint32_t standbyTime = 0;               //!< Time (ms) in STANDBY since the last status update
+static uint32_t rtcResidue = 0;                         //!< RTC to kernel tick conversion remainder
+static uint8_t lastLatency = 0;                         //!< Last CAN wake-up latency (10us)
+static uint8_t maxLatency = 0;                          //!< Max CAN wake-up latency (10us)
+static TickType_t lastUpdate = 0;                       //!< Tick of the last status update
+
+/**
+ * This function initializes the module.
+ *
+ * The EIC is clocked by the ULP 32KHz oscillator with asynchronous
+ * edge detection, so it can wake-up the device from STANDBY.
+ * The wake-up interrupts are enabled only in STANDBY.
+ *
+ * The power mode is read from the PROTO_PARAM_POWER_MODE register:
+ * the function shall be called after the ApplicationProtocolInit().
+ */
+void PowerSaveInit(void){
+    EIC_REGS->EIC_CTRLA = EIC_CTRLA_SWRST_Msk;
+    while((EIC_REGS->EIC_SYNCBUSY & EIC_SYNCBUSY_SWRST_Msk) == EIC_SYNCBUSY_SWRST_Msk);
+
+    EIC_REGS->EIC_CTRLA = EIC_CTRLA_CKSEL_Msk;
+    EIC_REGS->EIC_CONFIG[0] = EIC_CONFIG_SENSE7(EIC_CONFIG_SENSE0_FALL_Val);    // CAN0 RX: start of frame
+    EIC_REGS->EIC_CONFIG[1] = EIC_CONFIG_SENSE3(EIC_CONFIG_SENSE0_BOTH_Val);    // Opto (EXTINT 11)
+    EIC_REGS->EIC_ASYNCH = EIC_ASYNCH_ASYNCH(CAN_RX_WAKE_MASK | OPTO_WAKE_MASK);
+    EIC_REGS->EIC_CTRLA |= EIC_CTRLA_ENABLE_Msk;
+    while((EIC_REGS->EIC_SYNCBUSY & EIC_SYNCBUSY_ENABLE_Msk) == EIC_SYNCBUSY_ENABLE_Msk);
+
+    NVIC_SetPriority(EIC_EXTINT_7_IRQn, 7);
+    NVIC_EnableIRQ(EIC_EXTINT_7_IRQn);
+    NVIC_SetPriority(EIC_EXTINT_11_IRQn, 7);
+    NVIC_EnableIRQ(EIC_EXTINT_11_IRQn);
+
+    PowerSaveSetMode(GETBYTE_PARAMETER_POWER_MODE);
+}
+
+/**
+ * This function sets the power mode.
+ *
+ * @param mode: this is the requested mode (POWER_MODE_IDLE or POWER_MODE_STANDBY)
+ * @return true if the mode is valid
+ */
+bool PowerSaveSetMode(uint8_t mode){
+    if(mode > POWER_MODE_STANDBY) return false;
+
+    powerMode = mode;
+    SETBYTE_POWER_MODE(wakeSource | ((mode == POWER_MODE_STANDBY) ? 0x1 : 0));
+    return true;
+}
+
+bool PowerSaveIsStandbyEnabled(void){
+    return (powerMode == POWER_MODE_STANDBY);
+}
+
+/**
+ * This function enables or disables the APB clock of APBA peripherals.
+ *
+ * The function can be called by any task or interrupt routine.
+ *
+ * @param mask: this is the MCLK_APBAMASK bit mask of the peripherals
+ * @param enable: true to enable the clock
+ */
+void PowerSaveApbaClock(uint32_t mask, bool enable){
+    UBaseType_t status = taskENTER_CRITICAL_FROM_ISR();
+    if(enable) MCLK_REGS->MCLK_APBAMASK |= mask;
+    else MCLK_REGS->MCLK_APBAMASK &= ~mask;
+    taskEXIT_CRITICAL_FROM_ISR(status);
+}
+
+/**
+ * This function assigns the wake-up pins to the EIC or back to their modules.
+ *
+ * - PA23: CAN0 RX (function I) or EXTINT 7 (function A);
+ * - PA11: opto GPIO input or EXTINT 11 (function A).
+ *
+ * @param enable: true to assign the pins to the EIC
+ */
+static void powerSaveWakePins(bool enable){
+    if(enable){
+        EIC_REGS->EIC_INTFLAG = CAN_RX_WAKE_MASK | OPTO_WAKE_MASK;
+        PORT_REGS->GROUP[0].PORT_PMUX[23 >> 1] &= (uint8_t) ~PORT_PMUX_PMUXO_Msk;
+        PORT_REGS->GROUP[0].PORT_PMUX[11 >> 1] &= (uint8_t) ~PORT_PMUX_PMUXO_Msk;
+        PORT_REGS->GROUP[0].PORT_PINCFG[11] |= (uint8_t) PORT_PINCFG_PMUXEN_Msk;
+        EIC_REGS->EIC_INTENSET = CAN_RX_WAKE_MASK | OPTO_WAKE_MASK;
+    }else{
+        EIC_REGS->EIC_INTENCLR = CAN_RX_WAKE_MASK | OPTO_WAKE_MASK;
+        PORT_REGS->GROUP[0].PORT_PINCFG[11] &= (uint8_t) ~PORT_PINCFG_PMUXEN_Msk;
+        PORT_REGS->GROUP[0].PORT_PMUX[23 >> 1] |= (uint8_t) PORT_PMUX_PMUXO(0x8);
+    }
+}
+
+/**
+ * This function returns true if the device can enter the STANDBY mode.
+ */
+static bool powerSaveStandbyReady(void){
+    if(powerMode != POWER_MODE_STANDBY) return false;
+    if(FilterIsRunning()) return false;
+    if(!XrayFanIsStatic()) return false;
+    if(StorageIsBusy() || HistoryIsBusy() || UpdateIsBusy()) return false;
+    if(ApplicationProtocolIsBusy()) return false;
+    if(LogIsBusy()) return false;
+    return true;
+}
+
+/**
+ * This is the FreeRTOS tickless idle implementation (portSUPPRESS_TICKS_AND_SLEEP()).
+ *
+ * The function is called by the Idle task, with the scheduler suspended,
+ * when the next task deadline is at least configEXPECTED_IDLE_TIME_BEFORE_SLEEP ticks away.
+ *
+ * If the STANDBY is not allowed the function returns immediately:
+ * the Idle task hook keeps the device in IDLE sleep mode.
+ *
+ * Otherwise the SysTick is stopped, the RTC COMP1 is set to the next deadline
+ * and the device enters the STANDBY mode. On wake-up the kernel tick count is
+ * advanced with the time measured by the RTC.
+ *
+ * @param expectedIdle: this is the time (ticks) to the next task deadline
+ */
+void PowerSaveSleep(TickType_t expectedIdle){
+    if(!powerSaveStandbyReady()) return;
+
+    __disable_irq();
+    __DSB();
+    __ISB();
+
+    // An interrupt in the meantime can have made a task ready
+    if(eTaskConfirmSleepModeStatus() == eAbortSleep){
+        __enable_irq();
+        return;
+    }
+
+    // Wake-up one tick before the deadline: the SysTick processes the last tick
+    uint32_t rtcTicks = ((expectedIdle - 1) * POWER_RTC_FREQUENCY) / configTICK_RATE_HZ;
+
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+    uint32_t start = RTC_Timer32CounterGet();
+    RTC_Timer32Compare1Set(start + rtcTicks);
+    RTC_Timer32InterruptEnable(RTC_TIMER32_INT_MASK_CMP1);
+    powerSaveWakePins(true);
+
+    PM_REGS->PM_SLEEPCFG = PM_SLEEPCFG_SLEEPMODE_STANDBY;
+    while((PM_REGS->PM_SLEEPCFG & PM_SLEEPCFG_SLEEPMODE_Msk) != PM_SLEEPCFG_SLEEPMODE_STANDBY);
+    __DSB();
+    __WFI();
+    __ISB();
+
+    // Clocks restored: the pending interrupt routines run at the end of the function
+    wakeTime = portGET_RUN_TIME_COUNTER_VALUE();
+    PM_REGS->PM_SLEEPCFG = PM_SLEEPCFG_SLEEPMODE_IDLE;
+    while((PM_REGS->PM_SLEEPCFG & PM_SLEEPCFG_SLEEPMODE_Msk) != PM_SLEEPCFG_SLEEPMODE_IDLE);
+
+    uint32_t flags = EIC_REGS->EIC_INTFLAG;
+    powerSaveWakePins(false);
+    RTC_Timer32InterruptDisable(RTC_TIMER32_INT_MASK_CMP1);
+
+    if(flags & CAN_RX_WAKE_MASK){
+        wakeSource = POWER_WAKE_CAN;
+        wakePending = true;
+    }else if(flags & OPTO_WAKE_MASK) wakeSource = POWER_WAKE_OPTO;
+    else wakeSource = POWER_WAKE_RTC;
+
+    // Kernel tick update: the conversion remainder is kept for the next time
+    rtcResidue += (RTC_Timer32CounterGet() - start) * configTICK_RATE_HZ;
+    TickType_t elapsed = rtcResidue / POWER_RTC_FREQUENCY;
+    rtcResidue %= POWER_RTC_FREQUENCY;
+    if(elapsed > (expectedIdle - 1)) elapsed = expectedIdle - 1;
+    vTaskStepTick(elapsed);
+    standbyTime += elapsed;
+
+    SysTick->VAL = 0;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+    __enable_irq();
+}
+
+/**
+ * This function updates the CAN wake-up latency and the POWER_STATUS_REGISTER.
+ *
+ * The function is called by the Protocol task every time it wakes up:
+ * the latency of a CAN wake-up is the time from the STANDBY exit
+ * to the first call after the wake-up.
+ */
+void PowerSaveLoop(void){
+    if(wakePending){
+        wakePending = false;
+
+        // Run time counter: 1.5MHz (15 counts = 10us)
+        uint32_t latency = (portGET_RUN_TIME_COUNTER_VALUE() - wakeTime) / 15;
+        if(latency > 255) latency = 255;
+        lastLatency = (uint8_t) latency;
+        if(lastLatency > maxLatency) maxLatency = lastLatency;
+    }
+
+    TickType_t now = xTaskGetTickCount();
+    if((now - lastUpdate) < pdMS_TO_TICKS(POWER_STATUS_PERIOD)) return;
+
+    taskENTER_CRITICAL();
+    uint32_t standby = standbyTime;
+    standbyTime = 0;
+    taskEXIT_CRITICAL();
+
+    uint32_t share = (standby * 100) / (now - lastUpdate);
+    lastUpdate = now;
+
+    SETBYTE_POWER_MODE(wakeSource | ((powerMode == POWER_MODE_STANDBY) ? 0x1 : 0));
+    SETBYTE_POWER_STANDBY((share > 100) ? 100 : share);
+    SETBYTE_POWER_LATENCY(lastLatency);
+    SETBYTE_POWER_MAX_LATENCY(maxLatency);
+}
+
+/**
+ * This is the CAN0 RX pin wake-up interrupt.
+ *
+ * The frame causing the wake-up is lost: the Protocol task is woken up
+ * to measure the wake-up latency.
+ */
+void EIC_EXTINT_7_Handler(void){
+    EIC_REGS->EIC_INTFLAG = CAN_RX_WAKE_MASK;
+    ApplicationProtocolNotify();
+}
+
+/**
+ * This is the opto pin wake-up interrupt.
+ */
+void EIC_EXTINT_11_Handler(void){
+    EIC_REGS->EIC_INTFLAG = OPTO_WAKE_MASK;
+}
@@ -0,0 +1,130 @@
+#ifndef _POWER_SAVE_H
+#define _POWER_SAVE_H
+
+#include "definitions.h"
+#include "application.h"
+
+#undef ext
+#undef ext_static
+
+#ifdef _POWER_SAVE_C
+    #define ext
+    #define ext_static static
+#else
+    #define ext extern
+    #define ext_static extern
+#endif
+
+/*!
+ * \defgroup powerSaveModule Low power management module
+ *
+ * \ingroup applicationModule
+ *
+ *
+ * This Module selects the sleep level of the device
+ * when no task is ready to run.
+ *
+ * ## Dependencies
+ *
+ * - PM module (sleep mode selection);
+ * - RTC module (COMP1: wake-up at the next task deadline);
+ * - EIC module (wake-up on the CAN0 RX and the opto pins);
+ * - MCLK module (APB clock gating);
+ *
+ * ## Sleep levels
+ *
+ * ### IDLE
+ *
+ * The Idle task hook executes the WFI in IDLE sleep mode:
+ * the CPU clock is stopped and all the peripherals keep running.
+ * The wake-up takes few CPU cycles, so the CAN response time is not affected.
+ * This is the only level used with PROTO_PARAM_POWER_MODE = POWER_MODE_IDLE (default).
+ *
+ * ### STANDBY
+ *
+ * With PROTO_PARAM_POWER_MODE = POWER_MODE_STANDBY the Idle task enters the STANDBY sleep mode
+ * (FreeRTOS tickless idle, see PowerSaveSleep()) when:
+ * - the next task deadline is at least configEXPECTED_IDLE_TIME_BEFORE_SLEEP ms away;
+ * - the motor is not running (TC1 and opto supervision not active);
+ * - the Fan is statically driven (TC0 stopped);
+ * - the Storage, the History and the Update modules are not writing the NVM or streaming;
+ * - no protocol command is in progress and no CAN frame is waiting for transmission;
+ * - the diagnostic log buffer is empty (\ref logModule).
+ *
+ * In STANDBY all the clocks but the 32KHz are stopped: the SysTick is stopped and
+ * the kernel tick count is updated with the RTC count on wake-up.
+ * The wake-up sources are:
+ * - the RTC COMP1, set to the next task deadline;
+ * - the CAN0 RX pin falling edge (EXTINT 7), temporarily assigned to the EIC;
+ * - the opto pin edges (EXTINT 11);
+ * - the RTC COMP0 (power light timeout).
+ *
+ * The CAN controller is not clocked in STANDBY:
+ * the frame waking up the device is lost and the Host shall repeat it.
+ * For this reason the STANDBY is enabled only by the Host.
+ * While the STANDBY is enabled the Protocol task polling period is
+ * POWER_STANDBY_POLL ms.
+ *
+ * The run time counter of the \ref diagnosticModule is stopped in STANDBY:
+ * the CPU load is referred to the time the device is awake.
+ *
+ * ## Clock gating
+ *
+ * The modules gate the APB clock of the peripherals not in use
+ * with PowerSaveApbaClock(): the TC1 clock is enabled only during a positioning.
+ *
+ * ## Wake-up latency
+ *
+ * After a CAN wake-up the time from the STANDBY exit (clocks restored)
+ * to the Protocol task execution is measured with the run time counter (1.5MHz).
+ * The clock restart time before the STANDBY exit is not included.
+ *
+ * The POWER_STATUS_REGISTER reports:
+ * - byte 0: bit 0 = STANDBY enabled, bits 4..6 = last wake-up source (POWER_WAKE_xx);
+ * - byte 1: time share (%) in STANDBY in the last second;
+ * - byte 2: last CAN wake-up latency (10us units, max 255);
+ * - byte 3: max CAN wake-up latency (10us units, max 255).
+ *
+ *  @{
+ *
+ */
+
+     /**
+    * \defgroup powerSaveApiModule API Module
+    *  @{
+    */
+
+        ext void PowerSaveInit(void);
+        ext void PowerSaveLoop(void);
+        ext bool PowerSaveSetMode(uint8_t mode);
+        ext bool PowerSaveIsStandbyEnabled(void);
+        ext void PowerSaveSleep(TickType_t expectedIdle);
+        ext void PowerSaveApbaClock(uint32_t mask, bool enable);
+
+    /** @}*/ // powerSaveApiModule
+
+    /**
+    * \defgroup powerSaveMacroModule Module's Macros
+    *  @{
+    */
+
+        #define POWER_MODE_IDLE         0           //!< PROTO_PARAM_POWER_MODE: IDLE sleep only
+        #define POWER_MODE_STANDBY      1           //!< PROTO_PARAM_POWER_MODE: STANDBY enabled
+
+        #define POWER_STANDBY_POLL      100         //!< Protocol task polling period (ms) with the STANDBY enabled
+        #define POWER_STATUS_PERIOD     1000        //!< POWER_STATUS_REGISTER update period (ms)
+        #define POWER_RTC_FREQUENCY     1024        //!< RTC counter frequency (Hz)
+
+        #define POWER_CAN_RX_EXTINT     7           //!< CAN0 RX pin (PA23) external interrupt
+        #define POWER_OPTO_EXTINT       11          //!< Opto pin (PA11) external interrupt
+
+        #define POWER_WAKE_RTC          0x10        //!< Last wake-up source: RTC (task deadline or power light timeout)
+        #define POWER_WAKE_CAN          0x20        //!< Last wake-up source: CAN activity
+        #define POWER_WAKE_OPTO         0x40        //!< Last wake-up source: opto
+
+    /** @}*/ // powerSaveMacroModule
+
+/** @}*/ // powerSaveModule
+
+
+#endif
@@ -0,0 +1,64 @@
+#define _PROFILER_C
+
+#include "application.h"
+#include "profiler.h"
+
+/**
+ * This function initializes the module.
+ *
+ * The DWT cycle counter is started by the reset handler
+ * (see \ref bootModule): the function clears all the probes.
+ */
+void ProfilerInit(void){
+    ProfilerReset();
+}
+
+/**
+ * This function clears all the probes.
+ *
+ * The probes are updated by the interrupt routines:
+ * the function masks the interrupts during the update.
+ */
+void ProfilerReset(void){
+#ifdef PROFILER_ENABLED
+    taskENTER_CRITICAL();
+    for(int i = 0; i < PROFILER_PROBES_NUM; i++){
+        profilerProbes[i].min = 0xFFFFFFFF;
+        profilerProbes[i].max = 0;
+        profilerProbes[i].total = 0;
+        profilerProbes[i].count = 0;
+    }
+    taskEXIT_CRITICAL();
+#endif
+}
+
+/**
+ * This function reads an item of a probe.
+ *
+ * @param probe: this is the probe index (PROFILER_PROBE_ENUM_t)
+ * @param item: this is the requested item (PROFILER_ITEM_ENUM_t)
+ * @param value: this is the pointer to the returned value
+ * @return true if the item is available
+ */
+bool ProfilerRead(uint8_t probe, uint8_t item, uint32_t* value){
+#ifdef PROFILER_ENABLED
+    PROFILER_PROBE_t p;
+
+    if(probe >= PROFILER_PROBES_NUM) return false;
+
+    // Consistent copy of the probe
+    taskENTER_CRITICAL();
+    p = profilerProbes[probe];
+    taskEXIT_CRITICAL();
+
+    switch(item){
+        case PROFILER_ITEM_COUNT: *value = p.count; return true;
+        case PROFILER_ITEM_MIN:   *value = (p.count) ? p.min : 0; return true;
+        case PROFILER_ITEM_MAX:   *value = p.max; return true;
+        case PROFILER_ITEM_MEAN:  *value = (p.count) ? (uint32_t) (p.total / p.count) : 0; return true;
+        default: return false;
+    }
+#else
+    return false;
+#endif
+}
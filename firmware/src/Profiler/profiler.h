@@ -0,0 +1,146 @@
+#ifndef _PROFILER_H
+#define _PROFILER_H
+
+#include "definitions.h"
+#include "application.h"
+
+#undef ext
+#undef ext_static
+
+#ifdef _PROFILER_C
+    #define ext
+    #define ext_static static
+#else
+    #define ext extern
+    #define ext_static extern
+#endif
+
+/*!
+ * \defgroup profilerModule Execution time profiler module
+ *
+ * \ingroup applicationModule
+ *
+ *
+ * This Module measures the execution time of the interrupt routines
+ * and of the periodic jobs with the DWT cycle counter.
+ *
+ * ## Dependencies
+ *
+ * - DWT unit of the Cortex-M4 core (CYCCNT register, started by the reset handler: see \ref bootModule);
+ *
+ * ## Build setting
+ *
+ * The probes are compiled only in the debug build (__DEBUG defined by MPLAB-X)
+ * or when PROFILER_ENABLED is defined in the compiler options:
+ * in the release build the PROFILER_START() and PROFILER_STOP() macros are empty
+ * and the GET_PROFILE command returns MET_CAN_COMMAND_NOT_AVAILABLE.
+ *
+ * ## Module Function Description
+ *
+ * A probe is a couple of PROFILER_START() / PROFILER_STOP() macros
+ * in the same code block: the start macro saves the CYCCNT in a local variable
+ * and the stop macro updates the min, max, total time and count of the probe
+ * (about 15 cycles at 120MHz).
+ *
+ * Every probe shall be used by only one task or by interrupt routines
+ * of the same priority: the probe fields are not protected.
+ * The measured time is the elapsed time: a probe in a task
+ * includes the time of the interrupts served in the middle.
+ *
+ * The probe results are read by the Host with the GET_PROFILE command:
+ * - d0: probe (see PROFILER_PROBE_ENUM_t);
+ * - d1: item (see PROFILER_ITEM_ENUM_t);
+ * - d2: 0 = low word, 1 = high word of the 32 bit result.
+ *
+ * The times are expressed in CPU cycles.
+ * The RESET_PROFILE command clears all the probes.
+ *
+ *  @{
+ *
+ */
+
+     /**
+    * \defgroup profilerStructModule Module Data structures
+    *  @{
+    */
+
+    /// This is the list of the implemented probes
+    typedef enum{
+        PROFILER_PROBE_FILTER_CALLBACK = 0, //!< TC1 step interrupt (filterCallback())
+        PROFILER_PROBE_FAN_LOOP,            //!< Fan controller (XrayFanLoop())
+        PROFILER_PROBE_RTC_EVENT,           //!< RTC interrupt (rtcEventHandler())
+        PROFILER_PROBE_CAN_INTERRUPT,       //!< CAN0 interrupt (CAN0_InterruptHandler())
+        PROFILER_PROBE_XRAY_LOOP,           //!< Temperature monitor (XrayLoop())
+        PROFILER_PROBES_NUM                 //!< Number of the implemented probes (not a probe)
+    }PROFILER_PROBE_ENUM_t;
+
+    /// This is the list of the probe items readable with the GET_PROFILE command
+    typedef enum{
+        PROFILER_ITEM_COUNT = 0,    //!< Number of measures
+        PROFILER_ITEM_MIN,          //!< Min time (cycles)
+        PROFILER_ITEM_MAX,          //!< Max time (cycles)
+        PROFILER_ITEM_MEAN,         //!< Mean time (cycles)
+    }PROFILER_ITEM_ENUM_t;
+
+    /// This is the probe data structure
+    typedef struct{
+        uint32_t min;       //!< Min time (cycles)
+        uint32_t max;       //!< Max time (cycles)
+        uint64_t total;     //!< Sum of the measured times (cycles)
+        uint32_t count;     //!< Number of measures
+    }PROFILER_PROBE_t;
+
+    /** @}*/ // profilerStructModule
+
+     /**
+    * \defgroup profilerApiModule API Module
+    *  @{
+    */
+
+        ext void ProfilerInit(void);
+        ext void ProfilerReset(void);
+        ext bool ProfilerRead(uint8_t probe, uint8_t item, uint32_t* value);
+
+    /** @}*/ // profilerApiModule
+
+    /**
+    * \defgroup profilerMacroModule Module's Macros
+    *  @{
+    */
+
+        #if defined(__DEBUG) && !defined(PROFILER_ENABLED)
+            #define PROFILER_ENABLED    //!< The probes are compiled in the debug build
+        #endif
+
+        #ifdef PROFILER_ENABLED
+
+            ext PROFILER_PROBE_t profilerProbes[PROFILER_PROBES_NUM];
+
+            /**
+             * This function adds a measure to a probe
+             *
+             * @param probe: this is the probe index
+             * @param cycles: this is the measured time
+             */
+            static inline void ProfilerRecord(PROFILER_PROBE_ENUM_t probe, uint32_t cycles){
+                PROFILER_PROBE_t* p = &profilerProbes[probe];
+
+                if(cycles < p->min) p->min = cycles;
+                if(cycles > p->max) p->max = cycles;
+                p->total += cycles;
+                p->count++;
+            }
+
+            #define PROFILER_START(probe)   uint32_t probe##_start = DWT->CYCCNT                   //!< Starts the measure of a probe
+            #define PROFILER_STOP(probe)    ProfilerRecord(probe, DWT->CYCCNT - probe##_start)     //!< Ends the measure of a probe
+        #else
+            #define PROFILER_START(probe)
+            #define PROFILER_STOP(probe)
+        #endif
+
+    /** @}*/ // profilerMacroModule
+
+/** @}*/ // profilerModule
+
+
+#endif
@@ -4,11 +4,29 @@
 #include "protocol.h"
 #include "../Filter/filter.h"
 #include "../PowerLed/power_led.h"
+#include "../XrayTube/xray_tube.h"
+#include "../Storage/storage.h"
+#include "../History/history.h"
+#include "../Profiler/profiler.h"
+#include "../Diagnostic/diagnostic.h"
+#include "../PowerSave/power_save.h"
+#include "../Update/update.h"
+#include "../Boot/boot.h"
+#include "interrupts.h"
 
 
 static void ApplicationProtocolCommandHandler(uint8_t cmd, uint8_t d0,uint8_t d1,uint8_t d2,uint8_t d3 ); //!< This is the Command protocol callback
+static bool ApplicationProtocolParameterHandler(uint8_t idx, uint8_t* d); //!< This is the Parameter write hook
+static void ApplicationProtocolParameterScan(void);
 static volatile unsigned char current_command = 0;
 
+static uint8_t parameterShadow[PROTO_PARAM_REGISTERS_NUM][4]; //!< Copy of the last accepted PARAMETER register content
+static uint8_t parameterRejected = 0; //!< Mask of the PARAMETER registers whose last write has been rejected (bit n = register n)
+
+static volatile uint8_t errorPendingClear = 0;  //!< PERS0 bits to be cleared, posted by the other tasks and interrupts
+static volatile uint8_t errorPendingSet = 0;    //!< PERS0 bits to be set, posted by the other tasks and interrupts
+static TaskHandle_t protocolTask = NULL;    //!< Protocol task handle, notified by the events to be served
+
 
 
 /**
@@ -25,6 +43,13 @@ static volatile unsigned char current_command = 0;
  * The function initializes the Parameters with the default value   
  * with the library MET_Can_Protocol_SetDefaultParameter() function.
  * 
+ * The Parameters stored into the SmartEEPROM (see \ref storageModule) 
+ * then replace the default values: every stored content is validated 
+ * with ApplicationProtocolParameterHandler() as a Host write.
+ * 
+ * The initial Parameter content is copied into the shadow registers
+ * used to detect the Parameter write events (see ApplicationProtocolParameterScan()).
+ * 
  */
 void ApplicationProtocolInit ( void )
 {
@@ -39,18 +64,179 @@ void ApplicationProtocolInit ( void )
     MET_Can_Protocol_SetDefaultParameter(PROTO_PARAM_FILTER4_POSITION,0,0,0,0);
     MET_Can_Protocol_SetDefaultParameter(PROTO_PARAM_MIRROR_POSITION,0,0,0,0);
     MET_Can_Protocol_SetDefaultParameter(PROTO_PARAM_LIGHT_TIMEOUT,5,0,0,0);
+    MET_Can_Protocol_SetDefaultParameter(PROTO_PARAM_FAN_CONTROL,50,20,100,0);
+    MET_Can_Protocol_SetDefaultParameter(PROTO_PARAM_POWER_MODE,POWER_MODE_IDLE,0,0,0);
+    
+    // Restores the stored Parameters
+    StorageInit();
+    StorageRestoreParameters(ApplicationProtocolParameterHandler);
     
+    // Initializes the shadow copy of the Parameters
+    for(int i = 0; i < PROTO_PARAM_REGISTERS_NUM; i++){
+        for(int j = 0; j < 4; j++) parameterShadow[i][j] = MET_Can_Protocol_GetParameter(i,j);
+    }
 }
   
 /**
- * This function shall be called by the MAIN loop application 
- * in order to manage the reception/transmission protocol activities.
+ * This function is the Protocol task.
+ * 
+ * The task waits for a notification (CAN interrupt, RTC interrupt, 
+ * command completion or ERROR register update) and then serves
+ * the protocol and the modules sharing the CAN and the NVM:
+ * - ApplicationProtocolLoop();
+ * - StorageLoop();
+ * - HistoryLoop();
+ * - UpdateLoop();
+ * - PowerLedLoop();
+ * - DiagnosticLoop();
+ * - BootLoop().
+ * 
+ * While the Storage, the History or the Update modules are writing the NVM or streaming,
+ * the task polls every tick. Otherwise the task wakes up at least every 
+ * PROTOCOL_TASK_IDLE_WAIT ms (POWER_STANDBY_POLL ms with the STANDBY enabled,
+ * see \ref powerSaveModule).
+ * 
+ * At every wake-up PowerSaveLoop() measures the CAN wake-up latency.
+ * 
+ * The first run of the task is the BOOT_STAGE_SCHEDULER (see \ref bootModule).
+ * 
+ * @param param: not used
+ */
+void ApplicationProtocolTask(void* param){
+    protocolTask = xTaskGetCurrentTaskHandle();
+    BootStage(BOOT_STAGE_SCHEDULER);
+    
+    while(true){
+        TickType_t wait = pdMS_TO_TICKS((PowerSaveIsStandbyEnabled()) ? POWER_STANDBY_POLL : PROTOCOL_TASK_IDLE_WAIT);
+        if(StorageIsBusy() || HistoryIsBusy() || UpdateIsBusy()) wait = 1;
+        ulTaskNotifyTake(pdTRUE, wait);
+        PowerSaveLoop();
+        
+        // Protocol management
+        ApplicationProtocolLoop();
+        
+        // Parameter storage management
+        StorageLoop();
+        
+        // Temperature history stream and snapshot management
+        HistoryLoop();
+        
+        // Firmware update download and trial supervision
+        UpdateLoop();
+        
+        // Power light status update
+        PowerLedLoop();
+        
+        // CPU load and stack usage registers update
+        DiagnosticLoop();
+        
+        // Boot time register update
+        BootLoop();
+    }
+}
+
+/**
+ * This function wakes up the Protocol task.
+ * 
+ * The function can be called by any task or interrupt routine.
+ */
+void ApplicationProtocolNotify(void){
+    if(protocolTask == NULL) return;
+    
+    if(xPortIsInsideInterrupt()){
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(protocolTask, &woken);
+        portYIELD_FROM_ISR(woken);
+    }else xTaskNotifyGive(protocolTask);
+}
+
+/**
+ * This is the CAN0 interrupt vector.
+ * 
+ * The function calls the CAN0 library handler 
+ * and then wakes up the Protocol task (reception or transmission completed).
+ * The first transmission completed after the reset is the BOOT_STAGE_RESPONSE.
+ */
+void ApplicationProtocolCanInterruptHandler(void){
+    PROFILER_START(PROFILER_PROBE_CAN_INTERRUPT);
+    CAN0_InterruptHandler();
+    if(CAN0_REGS->CAN_TXBTO) BootCanTransmitted();
+    PROFILER_STOP(PROFILER_PROBE_CAN_INTERRUPT);
+    ApplicationProtocolNotify();
+}
+
+/**
+ * This function returns true if a command is in progress 
+ * or a frame is waiting for transmission.
+ * 
+ * The function is used to enter the STANDBY mode (see \ref powerSaveModule).
+ */
+bool ApplicationProtocolIsBusy(void){
+    if(current_command) return true;
+    return (CAN0_REGS->CAN_TXBRP != 0);
+}
+
+/**
+ * This function posts an ERROR register update to the Protocol task.
+ * 
+ * The ERROR register is modified only by the Protocol task:
+ * the function can be called by any task or interrupt routine.
+ * 
+ * The update is merged into the pending set and clear masks, 
+ * so no update can be lost: the last update of every bit wins.
+ * 
+ * @param clear: this is the PERS0 bit mask to be cleared
+ * @param set: this is the PERS0 bit mask to be set
+ */
+static void ApplicationProtocolPostError(uint8_t clear, uint8_t set){
+    UBaseType_t status = taskENTER_CRITICAL_FROM_ISR();
+    errorPendingClear = (errorPendingClear & ~set) | clear;
+    errorPendingSet = (errorPendingSet & ~clear) | set;
+    taskEXIT_CRITICAL_FROM_ISR(status);
+    
+    ApplicationProtocolNotify();
+}
+
+/**
+ * This function applies the pending ERROR register updates.
+ * 
+ * The error bit of the Status Flags is updated accordingly.
+ */
+static void ApplicationProtocolErrorUpdate(void){
+    unsigned char error_pers0;
+    unsigned char error_pers1;
+    
+    // The pending masks are swapped out in a critical section
+    UBaseType_t status = taskENTER_CRITICAL_FROM_ISR();
+    uint8_t clear = errorPendingClear;
+    uint8_t set = errorPendingSet;
+    errorPendingClear = 0;
+    errorPendingSet = 0;
+    taskEXIT_CRITICAL_FROM_ISR(status);
+    
+    if((clear | set) == 0) return;
+    
+    MET_Can_Protocol_GetErrors(0, 0, &error_pers0, &error_pers1);
+    error_pers0 &= ~clear;
+    error_pers0 |= set;
+    MET_Can_Protocol_SetErrors(0, 0, &error_pers0, &error_pers1);
+    
+    if((error_pers0) ||(error_pers1)) SETBIT_FLAGS_ERRORS(true); // Sets the error bit in the Status Flags 
+    else SETBIT_FLAGS_ERRORS(false); // Sets the error bit in the Status Flags 
+}
+
+/**
+ * This function manages the reception/transmission protocol activities.
  * 
- * The function merely call the library function  MET_Can_Protocol_Loop().
+ * The function applies the pending ERROR register updates,
+ * calls the library function  MET_Can_Protocol_Loop() 
+ * and then checks the PARAMETER registers for a write event.
  */
 void inline ApplicationProtocolLoop(void){
 
+    ApplicationProtocolErrorUpdate();
     MET_Can_Protocol_Loop();
+    ApplicationProtocolParameterScan();
 
     if(!current_command) return;
     
@@ -64,6 +250,32 @@ void inline ApplicationProtocolLoop(void){
         current_command = 0;
         return;
     }
+    
+    if(current_command == GET_TEMPERATURE_HISTORY) {
+        if(HistoryIsStreaming()) return;
+        
+        MET_Can_Protocol_returnCommandExecuted((uint8_t) HistoryStreamLength(), (uint8_t) (HistoryStreamLength() >> 8));
+        current_command = 0;
+        return;
+    }
+    
+    if(current_command == UPDATE_START) {
+        if(UpdateIsBusy()) return;
+        
+        MET_Can_Protocol_returnCommandExecuted(0,0);
+        current_command = 0;
+        return;
+    }
+    
+    if(current_command == UPDATE_ACTIVATE) {
+        if(UpdateGetStatus() == UPDATE_VERIFY) return;
+        
+        // The bank swap follows the response transmission
+        if(UpdateGetStatus() == UPDATE_SWAP) MET_Can_Protocol_returnCommandExecuted(0,0);
+        else MET_Can_Protocol_returnCommandError(COMMAND_ERROR_UPDATE_CRC);
+        current_command = 0;
+        return;
+    }
 }
 
 /**
@@ -74,7 +286,12 @@ void ApplicationProtocolCommandHandler(uint8_t cmd, uint8_t d0,uint8_t d1,uint8_
 
     switch(cmd){
         case MET_COMMAND_ABORT:  // This is the Library mandatory 
-            
+            if(current_command == GET_TEMPERATURE_HISTORY){
+                HistoryStreamStop();
+                current_command = 0;
+            }
+            UpdateAbort();
+            if(((current_command == UPDATE_START) || (current_command == UPDATE_ACTIVATE)) && (UpdateGetStatus() == UPDATE_IDLE)) current_command = 0;
             break;
         
         // This is the command implementing the Slot selection
@@ -104,6 +321,86 @@ void ApplicationProtocolCommandHandler(uint8_t cmd, uint8_t d0,uint8_t d1,uint8_
             MET_Can_Protocol_returnCommandExecuted(0,0); // The Command is immediatelly executed
             break;
             
+        // This is the command streaming the temperature history
+        case GET_TEMPERATURE_HISTORY:
+            if(HistoryIsStreaming()) MET_Can_Protocol_returnCommandError(MET_CAN_COMMAND_BUSY);
+            else if(HistoryStreamStart(d0)){
+                // The Protocol loop is in charge to send the MET_Can_Protocol_returnCommandExecuted() at the end of the stream
+                MET_Can_Protocol_returnCommandExecuting();
+                current_command = cmd;
+            }else MET_Can_Protocol_returnCommandError(MET_CAN_COMMAND_INVALID_DATA);
+            break;
+            
+        // This is the command starting a firmware download: d0..d2 = image length
+        case UPDATE_START:
+            if(current_command) MET_Can_Protocol_returnCommandError(MET_CAN_COMMAND_BUSY);
+            else if(UpdateStart((uint32_t) d0 | ((uint32_t) d1 << 8) | ((uint32_t) d2 << 16))){
+                // The Protocol loop is in charge to send the MET_Can_Protocol_returnCommandExecuted() when the bank is erased
+                MET_Can_Protocol_returnCommandExecuting();
+                current_command = cmd;
+            }else MET_Can_Protocol_returnCommandError(MET_CAN_COMMAND_INVALID_DATA);
+            break;
+            
+        // These are the commands writing the next 4 bytes of the firmware image (even and odd word):
+        // the answer is the index of the next expected word
+        case UPDATE_DATA:
+        case UPDATE_DATA_ODD:
+        {
+            uint8_t d[4] = {d0, d1, d2, d3};
+            
+            if(UpdateIsBusy()) MET_Can_Protocol_returnCommandError(MET_CAN_COMMAND_BUSY);
+            else if(UpdateData(d, (cmd == UPDATE_DATA_ODD))) MET_Can_Protocol_returnCommandExecuted((uint8_t) (UpdateGetReceived() >> 2), (uint8_t) (UpdateGetReceived() >> 10));
+            else MET_Can_Protocol_returnCommandError(MET_CAN_COMMAND_INVALID_DATA);
+        }
+            break;
+            
+        // This is the command verifying the firmware image: d0..d3 = image CRC32
+        case UPDATE_ACTIVATE:
+            if(current_command || UpdateIsBusy()) MET_Can_Protocol_returnCommandError(MET_CAN_COMMAND_BUSY);
+            else if(UpdateActivate((uint32_t) d0 | ((uint32_t) d1 << 8) | ((uint32_t) d2 << 16) | ((uint32_t) d3 << 24))){
+                // The Protocol loop is in charge to send the MET_Can_Protocol_returnCommandExecuted() at the end of the verification
+                MET_Can_Protocol_returnCommandExecuting();
+                current_command = cmd;
+            }else MET_Can_Protocol_returnCommandError(MET_CAN_COMMAND_INVALID_DATA);
+            break;
+            
+        case GET_UPDATE_STATUS:
+            MET_Can_Protocol_returnCommandExecuted((uint8_t) UpdateGetStatus(), UpdateGetTrialStatus());
+            break;
+            
+        // This is the command reading a boot stage time stamp: d0 = stage, d2 selects the result word
+        case GET_BOOT_TIME:
+        {
+            uint32_t value;
+            
+            if(!BootRead(d0, &value)) MET_Can_Protocol_returnCommandError(MET_CAN_COMMAND_INVALID_DATA);
+            else{
+                if(d2) value >>= 16;
+                MET_Can_Protocol_returnCommandExecuted((uint8_t) value, (uint8_t) (value >> 8));
+            }
+        }
+            break;
+            
+        #ifdef PROFILER_ENABLED
+        // This is the command reading a profiler probe: d2 selects the result word
+        case GET_PROFILE:
+        {
+            uint32_t value;
+            
+            if(!ProfilerRead(d0, d1, &value)) MET_Can_Protocol_returnCommandError(MET_CAN_COMMAND_INVALID_DATA);
+            else{
+                if(d2) value >>= 16;
+                MET_Can_Protocol_returnCommandExecuted((uint8_t) value, (uint8_t) (value >> 8));
+            }
+        }
+            break;
+            
+        case RESET_PROFILE:
+            ProfilerReset();
+            MET_Can_Protocol_returnCommandExecuted(0,0);
+            break;
+        #endif
+            
         default:
             MET_Can_Protocol_returnCommandError(MET_CAN_COMMAND_NOT_AVAILABLE);
     }
@@ -111,117 +408,104 @@ void ApplicationProtocolCommandHandler(uint8_t cmd, uint8_t d0,uint8_t d1,uint8_
     return;
 }
 
-void setStatorErrorLow(bool stat){
-    unsigned char error_pers0;
-    unsigned char error_pers1;
-    MET_Can_Protocol_GetErrors(0, 0, &error_pers0, &error_pers1);
-    
-    error_pers0 &= ~PERS0_STATOR_SENS_LOW;
-    error_pers0 &= ~PERS0_STATOR_SENS_SHORT;
-    error_pers0 &= ~PERS0_STATOR_SENS_HIGH;
-    
-    if(stat)  error_pers0 |= PERS0_STATOR_SENS_LOW;   
-    MET_Can_Protocol_SetErrors(0, 0, &error_pers0, &error_pers1);
+/**
+ * This function detects the PARAMETER register write events.
+ * 
+ * The MET_Can_Protocol library doesn't notify the Application 
+ * when a PARAMETER register is written by the Host: 
+ * this function compares every register with its shadow copy
+ * and in case of difference calls the ApplicationProtocolParameterHandler() hook.
+ * 
+ * The Protocol task runs only after a notification (see ApplicationProtocolTask()),
+ * so all the registers are checked at every call.
+ * 
+ * The accepted content is stored into the SmartEEPROM.
+ * If the hook rejects the new content, the last accepted content
+ * is restored into the register and the rejection is reported to the Host:
+ * the register bit in the PARAMETER_STATUS_REGISTER and the PERS0_PARAM_REJECTED error
+ * (cleared by the next accepted write).
+ * 
+ */
+static void ApplicationProtocolParameterScan(void){
+    uint8_t d[4];
+    uint8_t rejected = parameterRejected;
     
-    if((error_pers0) ||(error_pers1)) SETBIT_FLAGS_ERRORS(true); // Sets the error bit in the Status Flags 
-    else SETBIT_FLAGS_ERRORS(false); // Sets the error bit in the Status Flags 
+    for(uint8_t idx = 0; idx < PROTO_PARAM_REGISTERS_NUM; idx++){
+        bool changed = false;
+        
+        for(int i = 0; i < 4; i++){
+            d[i] = MET_Can_Protocol_GetParameter(idx,i);
+            if(d[i] != parameterShadow[idx][i]) changed = true;
+        }
+        if(!changed) continue;
+
+        if(ApplicationProtocolParameterHandler(idx, d)){
+            for(int i = 0; i < 4; i++) parameterShadow[idx][i] = d[i];        
+            StorageWriteParameter(idx, d);
+            rejected &= ~(1 << idx);
+        }else{
+            // The new value is rejected: restore the last accepted content
+            MET_Can_Protocol_SetDefaultParameter(idx, parameterShadow[idx][0], parameterShadow[idx][1], parameterShadow[idx][2], parameterShadow[idx][3]);
+            rejected |= (1 << idx);
+        }
+    }
     
+    if(rejected == parameterRejected) return;
+    parameterRejected = rejected;
+    SETBYTE_PARAMETER_REJECTED(rejected);
+    if(rejected) ApplicationProtocolPostError(0, PERS0_PARAM_REJECTED);
+    else ApplicationProtocolPostError(PERS0_PARAM_REJECTED, 0);
 }
-    
-void setStatorErrorShort(bool stat){
-    unsigned char error_pers0;
-    unsigned char error_pers1;
-    MET_Can_Protocol_GetErrors(0, 0, &error_pers0, &error_pers1);
-    
-    error_pers0 &= ~PERS0_STATOR_SENS_LOW;
-    error_pers0 &= ~PERS0_STATOR_SENS_SHORT;
-    error_pers0 &= ~PERS0_STATOR_SENS_HIGH;
 
-    if(stat)  error_pers0 |= PERS0_STATOR_SENS_SHORT;
-    MET_Can_Protocol_SetErrors(0, 0, &error_pers0, &error_pers1);
+/**
+ * This is the Parameter write hook.
+ * 
+ * The function is called every time the content of a PARAMETER register 
+ * changes, and it forwards the new value to the modules using it.
+ * 
+ * @param idx: this is the PARAMETER register index
+ * @param d: this is the new content of the register
+ * @return true if the new content is accepted
+ */
+static bool ApplicationProtocolParameterHandler(uint8_t idx, uint8_t* d){
     
-    if((error_pers0) ||(error_pers1)) SETBIT_FLAGS_ERRORS(true); // Sets the error bit in the Status Flags 
-    else SETBIT_FLAGS_ERRORS(false); // Sets the error bit in the Status Flags 
+    switch(idx){
+        case PROTO_PARAM_FILTER1_POSITION: return FilterSetSlotPosition(POSITIONER_SELECT_FILTER1, d[0] + 256 * d[1]);
+        case PROTO_PARAM_FILTER2_POSITION: return FilterSetSlotPosition(POSITIONER_SELECT_FILTER2, d[0] + 256 * d[1]);
+        case PROTO_PARAM_FILTER3_POSITION: return FilterSetSlotPosition(POSITIONER_SELECT_FILTER3, d[0] + 256 * d[1]);
+        case PROTO_PARAM_FILTER4_POSITION: return FilterSetSlotPosition(POSITIONER_SELECT_FILTER4, d[0] + 256 * d[1]);
+        case PROTO_PARAM_MIRROR_POSITION:  return FilterSetSlotPosition(POSITIONER_SELECT_MIRROR, d[0] + 256 * d[1]);
+        case PROTO_PARAM_FAN_CONTROL:      return XrayFanSetControl(d[0], d[1], d[2]);
+        case PROTO_PARAM_POWER_MODE:       return PowerSaveSetMode(d[0]);
+        default: 
+            return true;
+    }
+}
+
+void setStatorErrorLow(bool stat){
+    ApplicationProtocolPostError(PERS0_STATOR_SENS_LOW | PERS0_STATOR_SENS_SHORT | PERS0_STATOR_SENS_HIGH, (stat) ? PERS0_STATOR_SENS_LOW : 0);
+}
     
+void setStatorErrorShort(bool stat){
+    ApplicationProtocolPostError(PERS0_STATOR_SENS_LOW | PERS0_STATOR_SENS_SHORT | PERS0_STATOR_SENS_HIGH, (stat) ? PERS0_STATOR_SENS_SHORT : 0);
 }
 
 void setStatorErrorHigh(bool stat){
-    unsigned char error_pers0;
-    unsigned char error_pers1;
-    MET_Can_Protocol_GetErrors(0, 0, &error_pers0, &error_pers1);
-
-    error_pers0 &= ~PERS0_STATOR_SENS_LOW;
-    error_pers0 &= ~PERS0_STATOR_SENS_SHORT;
-    error_pers0 &= ~PERS0_STATOR_SENS_HIGH;
-
-    if(stat)  error_pers0 |= PERS0_STATOR_SENS_HIGH;
-    MET_Can_Protocol_SetErrors(0, 0, &error_pers0, &error_pers1);
-    
-    if((error_pers0) ||(error_pers1)) SETBIT_FLAGS_ERRORS(true); // Sets the error bit in the Status Flags 
-    else SETBIT_FLAGS_ERRORS(false); // Sets the error bit in the Status Flags 
-    
+    ApplicationProtocolPostError(PERS0_STATOR_SENS_LOW | PERS0_STATOR_SENS_SHORT | PERS0_STATOR_SENS_HIGH, (stat) ? PERS0_STATOR_SENS_HIGH : 0);
 }
     
 void setBulbErrorLow(bool stat){
-    unsigned char error_pers0;
-    unsigned char error_pers1;
-    MET_Can_Protocol_GetErrors(0, 0, &error_pers0, &error_pers1);
-
-    error_pers0 &= ~PERS0_BULB_SENS_LOW;
-    error_pers0 &= ~PERS0_BULB_SENS_SHORT;
-    error_pers0 &= ~PERS0_BULB_SENS_HIGH;
-
-    if(stat)  error_pers0 |= PERS0_BULB_SENS_LOW;
-    MET_Can_Protocol_SetErrors(0, 0, &error_pers0, &error_pers1);
-    
-    if((error_pers0) ||(error_pers1)) SETBIT_FLAGS_ERRORS(true); // Sets the error bit in the Status Flags 
-    else SETBIT_FLAGS_ERRORS(false); // Sets the error bit in the Status Flags 
-    
+    ApplicationProtocolPostError(PERS0_BULB_SENS_LOW | PERS0_BULB_SENS_SHORT | PERS0_BULB_SENS_HIGH, (stat) ? PERS0_BULB_SENS_LOW : 0);
 }
 
 void setBulbErrorShort(bool stat){
-    unsigned char error_pers0;
-    unsigned char error_pers1;
-    MET_Can_Protocol_GetErrors(0, 0, &error_pers0, &error_pers1);
-
-    error_pers0 &= ~PERS0_BULB_SENS_LOW;
-    error_pers0 &= ~PERS0_BULB_SENS_SHORT;
-    error_pers0 &= ~PERS0_BULB_SENS_HIGH;
-
-    if(stat)  error_pers0 |= PERS0_BULB_SENS_SHORT;
-    MET_Can_Protocol_SetErrors(0, 0, &error_pers0, &error_pers1);
-    
-    if((error_pers0) ||(error_pers1)) SETBIT_FLAGS_ERRORS(true); // Sets the error bit in the Status Flags 
-    else SETBIT_FLAGS_ERRORS(false); // Sets the error bit in the Status Flags 
-    
+    ApplicationProtocolPostError(PERS0_BULB_SENS_LOW | PERS0_BULB_SENS_SHORT | PERS0_BULB_SENS_HIGH, (stat) ? PERS0_BULB_SENS_SHORT : 0);
 }
 
 void setBulbErrorHigh(bool stat){
-    unsigned char error_pers0;
-    unsigned char error_pers1;
-    MET_Can_Protocol_GetErrors(0, 0, &error_pers0, &error_pers1);
-    error_pers0 &= ~PERS0_BULB_SENS_LOW;
-    error_pers0 &= ~PERS0_BULB_SENS_SHORT;
-    error_pers0 &= ~PERS0_BULB_SENS_HIGH;
-
-    if(stat)  error_pers0 |= PERS0_BULB_SENS_HIGH;
-    MET_Can_Protocol_SetErrors(0, 0, &error_pers0, &error_pers1);
-    
-    if((error_pers0) ||(error_pers1)) SETBIT_FLAGS_ERRORS(true); // Sets the error bit in the Status Flags 
-    else SETBIT_FLAGS_ERRORS(false); // Sets the error bit in the Status Flags 
-    
+    ApplicationProtocolPostError(PERS0_BULB_SENS_LOW | PERS0_BULB_SENS_SHORT | PERS0_BULB_SENS_HIGH, (stat) ? PERS0_BULB_SENS_HIGH : 0);
 }
 
 void setFilterError(bool stat){
-    unsigned char error_pers0;
-    unsigned char error_pers1;
-    MET_Can_Protocol_GetErrors(0, 0, &error_pers0, &error_pers1);
-    
-    if(stat)  error_pers0 |= PERS0_FILTER_SEL_FAIL;
-    else error_pers0 &= ~PERS0_FILTER_SEL_FAIL;
-    MET_Can_Protocol_SetErrors(0, 0, &error_pers0, &error_pers1);
-    
-    if((error_pers0) ||(error_pers1)) SETBIT_FLAGS_ERRORS(true); // Sets the error bit in the Status Flags 
-    else SETBIT_FLAGS_ERRORS(false); // Sets the error bit in the Status Flags 
-    
-}
\ No newline at end of file
+    ApplicationProtocolPostError(PERS0_FILTER_SEL_FAIL, (stat) ? PERS0_FILTER_SEL_FAIL : 0);
+}
@@ -38,6 +38,35 @@
  * The Application implements the communication protocol  
  * described in the PCB/22-303 Software Communication protocol specifications.
  * 
+ * ## Protocol task
+ * 
+ * The protocol is served by the ApplicationProtocolTask(), the highest priority
+ * application task: the motion supervision (\ref filterModule) and 
+ * the thermal control (\ref xrayTubeModule) run at lower priorities,
+ * so they never delay the protocol response.
+ * 
+ * The task sleeps until notified by:
+ * - the CAN0 interrupt (ApplicationProtocolCanInterruptHandler());
+ * - the power light timeout (RTC interrupt);
+ * - the command completion and the ERROR register updates.
+ * 
+ * The ERROR register is modified only by the Protocol task: 
+ * the setXXXError() functions merge the update into two pending masks 
+ * (bits to be set and bits to be cleared, the last update of a bit wins), 
+ * so they can be called by any task or interrupt routine and no update is lost.
+ * 
+ * ## Parameter write rejection
+ * 
+ * A PARAMETER register write is acknowledged by the library before 
+ * the Application validates the new content (see ApplicationProtocolParameterScan()).
+ * A rejected content is replaced with the last accepted one: the bit of the register 
+ * is set in the PARAMETER_STATUS_REGISTER byte 0 and the PERS0_PARAM_REJECTED error is set.
+ * The bit is cleared by the next accepted write of the same register and the error 
+ * is cleared when no register is rejected.
+ * 
+ * After a PARAMETER write the Host shall check the PERS0_PARAM_REJECTED error 
+ * (or re-read the register): the write ack doesn't mean the content is in use.
+ * 
  *  @{
  * 
  */
@@ -51,9 +80,14 @@
      */
         // Can Module Definitions
         static const unsigned char   MET_CAN_APP_DEVICE_ID    =  0x13 ;     //!< Application DEVICE CAN Id address
-        static const unsigned char   MET_CAN_STATUS_REGISTERS =  1 ;        //!< Defines the total number of implemented STATUS registers 
+        static const unsigned char   MET_CAN_STATUS_REGISTERS =  8 ;        //!< Defines the total number of implemented STATUS registers 
         static const unsigned char   MET_CAN_DATA_REGISTERS   =  0 ;        //!< Defines the total number of implemented Application DATA registers 
-        static const unsigned char   MET_CAN_PARAM_REGISTERS  =  6 ;        //!< Defines the total number of implemented PARAMETER registers 
+        static const unsigned char   MET_CAN_PARAM_REGISTERS  =  8 ;        //!< Defines the total number of implemented PARAMETER registers 
+
+        // Protocol task
+        #define PROTOCOL_TASK_PRIORITY      (tskIDLE_PRIORITY + 4)  //!< Protocol task priority (the highest application priority)
+        #define PROTOCOL_TASK_STACK         512                     //!< Protocol task stack size (words)
+        #define PROTOCOL_TASK_IDLE_WAIT     10                      //!< Max time (ms) the task waits for a notification (POWER_STANDBY_POLL with the STANDBY enabled)
 
      /// @}   moduleConstants
 
@@ -67,9 +101,21 @@
         /// This is the Protocol initialization function
         ext void ApplicationProtocolInit ( void);
 
-        /// This is the Main Loop protocol function
+        /// This is the protocol loop function, called by the Protocol task
         ext void  ApplicationProtocolLoop(void);
 
+        /// This is the Protocol task
+        ext void ApplicationProtocolTask(void* param);
+
+        /// This function wakes up the Protocol task (task or interrupt context)
+        ext void ApplicationProtocolNotify(void);
+
+        /// This is the CAN0 interrupt vector
+        ext void ApplicationProtocolCanInterruptHandler(void);
+
+        /// This function returns true if a command is in progress or a frame is waiting for transmission
+        ext bool ApplicationProtocolIsBusy(void);
+
         ext void setStatorErrorHigh(bool stat);
         ext void setStatorErrorShort(bool stat);
         ext void setStatorErrorLow(bool stat);
@@ -93,6 +139,7 @@
         #define PERS0_STATOR_SENS_HIGH  0x10
         #define PERS0_STATOR_SENS_SHORT 0x20
         #define PERS0_FILTER_SEL_FAIL   0x40
+        #define PERS0_PARAM_REJECTED    0x80    //!< A PARAMETER register write has been rejected (see PARAMETER_STATUS_REGISTER)
 
         
 
@@ -109,6 +156,13 @@
      /// This is the list of the implemented STATUS REGISTERS    
      typedef enum{
         SYSTEM_STATUS_REGISTER = 0, //!< This is the Internal Status  
+        TEMPERATURE_STATUS_REGISTER, //!< This is the Sensors temperature Status
+        LOAD_STATUS_REGISTER, //!< This is the CPU load of the last period (see \ref diagnosticModule)
+        PEAK_LOAD_STATUS_REGISTER, //!< This is the peak CPU load since the startup
+        STACK_STATUS_REGISTER, //!< This is the stack peak usage of the tasks
+        POWER_STATUS_REGISTER, //!< This is the low power status (see \ref powerSaveModule)
+        BOOT_STATUS_REGISTER, //!< This is the reset cause and the boot time (see \ref bootModule)
+        PARAMETER_STATUS_REGISTER, //!< This is the list of the PARAMETER registers whose last write has been rejected
               
      }PROTO_STATUS_t;
     #define SYSTEM_FILTER_STATUS_BYTE 0
@@ -141,6 +195,55 @@
     
     #define SETBIT_FLAGS_ERRORS(val)  MET_Can_Protocol_SetStatusBit(SYSTEM_STATUS_REGISTER, SYSTEM_FLAGS_BYTE, 0x80, val) //!< This bit is the Filter in error condition
     #define GETBIT_FLAGS_ERRORS(val)  MET_Can_Protocol_TestStatus(SYSTEM_STATUS_REGISTER, SYSTEM_FLAGS_BYTE, 0x80) //!< This bit is the Filter in error condition
+
+    #define TEMPERATURE_STATOR_BYTE 0
+    #define TEMPERATURE_BULB_BYTE 1
+
+    #define SETBYTE_STATOR_TEMP(val)  MET_Can_Protocol_SetStatusReg(TEMPERATURE_STATUS_REGISTER, TEMPERATURE_STATOR_BYTE, val) //!< This is the Stator temperature in C
+    #define GETBYTE_STATOR_TEMP  MET_Can_Protocol_GetStatus(TEMPERATURE_STATUS_REGISTER, TEMPERATURE_STATOR_BYTE) //!< This is the Stator temperature in C
+
+    #define SETBYTE_BULB_TEMP(val)  MET_Can_Protocol_SetStatusReg(TEMPERATURE_STATUS_REGISTER, TEMPERATURE_BULB_BYTE, val) //!< This is the Bulb temperature in C
+    #define GETBYTE_BULB_TEMP  MET_Can_Protocol_GetStatus(TEMPERATURE_STATUS_REGISTER, TEMPERATURE_BULB_BYTE) //!< This is the Bulb temperature in C
+
+    #define LOAD_IDLE_BYTE 0
+    #define LOAD_PROTOCOL_BYTE 1
+    #define LOAD_MOTION_BYTE 2
+    #define LOAD_THERMAL_BYTE 3
+
+    #define SETBYTE_LOAD(idx, val)  MET_Can_Protocol_SetStatusReg(LOAD_STATUS_REGISTER, idx, val) //!< This is the CPU share (%) of the last period: idx = LOAD_xx_BYTE
+    #define GETBYTE_LOAD(idx)  MET_Can_Protocol_GetStatus(LOAD_STATUS_REGISTER, idx) //!< This is the CPU share (%) of the last period: idx = LOAD_xx_BYTE
+
+    #define SETBYTE_PEAK_LOAD(idx, val)  MET_Can_Protocol_SetStatusReg(PEAK_LOAD_STATUS_REGISTER, idx, val) //!< This is the min idle (%) and the max task CPU share (%): idx = LOAD_xx_BYTE
+    #define GETBYTE_PEAK_LOAD(idx)  MET_Can_Protocol_GetStatus(PEAK_LOAD_STATUS_REGISTER, idx) //!< This is the min idle (%) and the max task CPU share (%): idx = LOAD_xx_BYTE
+
+    #define STACK_PROTOCOL_BYTE 0
+    #define STACK_MOTION_BYTE 1
+    #define STACK_THERMAL_BYTE 2
+    #define STACK_TIMER_BYTE 3
+
+    #define SETBYTE_STACK(idx, val)  MET_Can_Protocol_SetStatusReg(STACK_STATUS_REGISTER, idx, val) //!< This is the stack peak usage (%): idx = STACK_xx_BYTE
+    #define GETBYTE_STACK(idx)  MET_Can_Protocol_GetStatus(STACK_STATUS_REGISTER, idx) //!< This is the stack peak usage (%): idx = STACK_xx_BYTE
+
+    #define POWER_MODE_BYTE 0
+    #define POWER_STANDBY_BYTE 1
+    #define POWER_LATENCY_BYTE 2
+    #define POWER_MAX_LATENCY_BYTE 3
+
+    #define SETBYTE_POWER_MODE(val)  MET_Can_Protocol_SetStatusReg(POWER_STATUS_REGISTER, POWER_MODE_BYTE, val) //!< This is the STANDBY enable bit and the last wake-up source
+    #define SETBYTE_POWER_STANDBY(val)  MET_Can_Protocol_SetStatusReg(POWER_STATUS_REGISTER, POWER_STANDBY_BYTE, val) //!< This is the time share (%) in STANDBY
+    #define SETBYTE_POWER_LATENCY(val)  MET_Can_Protocol_SetStatusReg(POWER_STATUS_REGISTER, POWER_LATENCY_BYTE, val) //!< This is the last CAN wake-up latency (10us)
+    #define SETBYTE_POWER_MAX_LATENCY(val)  MET_Can_Protocol_SetStatusReg(POWER_STATUS_REGISTER, POWER_MAX_LATENCY_BYTE, val) //!< This is the max CAN wake-up latency (10us)
+
+    #define BOOT_CAUSE_BYTE 0
+    #define BOOT_STAGE_BYTE 1
+    #define BOOT_RESPONSE_LSB_BYTE 2
+    #define BOOT_RESPONSE_MSB_BYTE 3
+
+    #define SETBYTE_BOOT(idx, val)  MET_Can_Protocol_SetStatusReg(BOOT_STATUS_REGISTER, idx, val) //!< This is the reset cause, the previous boot stage and the first CAN response time (100us): idx = BOOT_xx_BYTE
+
+    #define PARAMETER_REJECTED_BYTE 0
+
+    #define SETBYTE_PARAMETER_REJECTED(val)  MET_Can_Protocol_SetStatusReg(PARAMETER_STATUS_REGISTER, PARAMETER_REJECTED_BYTE, val) //!< This is the mask of the rejected PARAMETER registers: bit n = register n
      
      
     
@@ -175,6 +278,9 @@
             PROTO_PARAM_FILTER4_POSITION,
             PROTO_PARAM_MIRROR_POSITION,
             PROTO_PARAM_LIGHT_TIMEOUT,
+            PROTO_PARAM_FAN_CONTROL, //!< This is the Fan controller setting: target temperature (C), min duty (%), max duty (%)
+            PROTO_PARAM_POWER_MODE, //!< This is the low power mode: POWER_MODE_IDLE or POWER_MODE_STANDBY (see \ref powerSaveModule)
+            PROTO_PARAM_REGISTERS_NUM //!< Number of the implemented PARAMETER registers (not a register): max 8, see PARAMETER_STATUS_REGISTER
                     
         }PROTO_PARAMETERS_t;
         
@@ -186,6 +292,10 @@
         #define GETWORD_PARAMETER_FILTER4_POSITION (MET_Can_Protocol_GetParameter(PROTO_PARAM_FILTER4_POSITION,0) + 256 * MET_Can_Protocol_GetParameter(PROTO_PARAM_FILTER4_POSITION,1))
         #define GETWORD_PARAMETER_MIRROR_POSITION (MET_Can_Protocol_GetParameter(PROTO_PARAM_MIRROR_POSITION,0) + 256 * MET_Can_Protocol_GetParameter(PROTO_PARAM_MIRROR_POSITION,1))
         #define GETBYTE_PARAMETER_LIGHT_TIMEOUT (MET_Can_Protocol_GetParameter(PROTO_PARAM_LIGHT_TIMEOUT,0))
+        #define GETBYTE_PARAMETER_FAN_TARGET_TEMP (MET_Can_Protocol_GetParameter(PROTO_PARAM_FAN_CONTROL,0))
+        #define GETBYTE_PARAMETER_FAN_MIN_DUTY (MET_Can_Protocol_GetParameter(PROTO_PARAM_FAN_CONTROL,1))
+        #define GETBYTE_PARAMETER_FAN_MAX_DUTY (MET_Can_Protocol_GetParameter(PROTO_PARAM_FAN_CONTROL,2))
+        #define GETBYTE_PARAMETER_POWER_MODE (MET_Can_Protocol_GetParameter(PROTO_PARAM_POWER_MODE,0))
 
 
     /// @}   ParamRegisterGroup
@@ -203,6 +313,15 @@
       SET_POSITIONER,
       SET_RAW_POSITIONER,
       SET_LIGHT,
+      GET_TEMPERATURE_HISTORY,  //!< Streams the temperature history (see \ref historyModule)
+      GET_PROFILE,              //!< Reads a probe of the execution time profiler (see \ref profilerModule)
+      RESET_PROFILE,            //!< Clears the probes of the execution time profiler
+      UPDATE_START,             //!< Starts a firmware download into the inactive flash bank (see \ref updateModule)
+      UPDATE_DATA,              //!< Writes the next 4 bytes of the firmware image, even word (UPDATE_DATA_ODD: odd word)
+      UPDATE_ACTIVATE,          //!< Verifies the firmware image and swaps the flash banks
+      GET_UPDATE_STATUS,        //!< Reads the firmware update and trial status
+      GET_BOOT_TIME,            //!< Reads a boot stage time stamp (see \ref bootModule)
+      UPDATE_DATA_ODD,          //!< Writes the next 4 bytes of the firmware image, odd word (UPDATE_DATA: even word)
     }PROTO_COMMAND_ENUM_t;
     
     #define POSITIONER_SELECT_FILTER1 1
@@ -219,6 +338,7 @@
     /// This is the list of the implemented ERRORS
     typedef enum{
         COMMAND_ERROR_FILTER_SELECTION_FAILED = MET_CAN_COMMAND_APPLICATION_ERRORS,      
+        COMMAND_ERROR_UPDATE_CRC,   //!< The firmware image CRC doesn't match
                 
     }PROTO_COMMAND_ERROR_ENUM_t;
 
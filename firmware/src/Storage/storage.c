@@ -0,0 +1,224 @@
+#define _STORAGE_C
+
+#include "application.h"
+#include "storage.h"
+#include "Protocol/protocol.h" 
+
+static volatile STORAGE_IMAGE_t* const storageImage = (volatile STORAGE_IMAGE_t*) SEEPROM_ADDR; //!< Storage image mapped into the SmartEEPROM
+static bool storageAvailable = false; //!< The SmartEEPROM is enabled and configured
+static volatile uint32_t* const updateState = (volatile uint32_t*) (SEEPROM_ADDR + STORAGE_UPDATE_OFFSET); //!< Firmware update state word
+static bool flushPending = false;     //!< The page buffer contains data not yet written into the NVM
+
+/**
+ * This function calculates the CRC16-CCITT of the storage image
+ * 
+ * The CRC covers the header and the stored PARAMETER registers.
+ * 
+ * @param num: this is the number of PARAMETER registers to be included
+ * @return the calculated CRC
+ */
+static uint16_t storageCrc(uint8_t num){
+    volatile uint8_t* pData = (volatile uint8_t*) storageImage;
+    uint16_t len = 4 + 4 * (uint16_t) num;
+    uint16_t crc = 0xFFFF;
+    
+    for(int i = 0; i < len; i++){
+        crc ^= ((uint16_t) pData[i]) << 8;
+        for(int j = 0; j < 8; j++){
+            if(crc & 0x8000) crc = (crc << 1) ^ 0x1021;
+            else crc = crc << 1;
+        }
+    }
+    
+    return crc;
+}
+
+/**
+ * This function waits the SmartEEPROM ready to accept a write.
+ * 
+ * If the active sector is full it is reallocated first.
+ */
+static void storageWaitReady(void){
+    while(NVMCTRL_SmartEEPROM_IsBusy());
+    if(NVMCTRL_SmartEEPROM_IsActiveSectorFull()){
+        NVMCTRL_SmartEEPROMSectorReallocate();
+        while(NVMCTRL_SmartEEPROM_IsBusy());
+    }
+}
+
+/**
+ * Module initialization.
+ * 
+ * The function verifies that the SmartEEPROM is enabled 
+ * by the User Row configuration and sets the buffered write mode.
+ */
+void StorageInit(void){
+    flushPending = false;
+    
+    // The SmartEEPROM is disabled if no block is assigned to the sectors
+    if((NVMCTRL_SmartEEPROMStatusGet() & NVMCTRL_SEESTAT_SBLK_Msk) == 0){
+        storageAvailable = false;
+        return;
+    }
+    
+    while(NVMCTRL_SmartEEPROM_IsBusy());
+    NVMCTRL_REGS->NVMCTRL_SEECFG = NVMCTRL_SEECFG_WMODE_BUFFERED;
+    storageAvailable = true;
+}
+
+/**
+ * This function shall be called by the Protocol task.
+ * 
+ * The function writes the page buffer into the NVM 
+ * as soon as the SmartEEPROM is ready.
+ */
+void StorageLoop(void){
+    if(!flushPending) return;
+    if(NVMCTRL_SmartEEPROM_IsBusy()) return;
+    
+    if(NVMCTRL_SmartEEPROM_IsActiveSectorFull()){
+        NVMCTRL_SmartEEPROMSectorReallocate();
+        return;
+    }
+    
+    NVMCTRL_SmartEEPROMFlushPageBuffer();
+    flushPending = false;
+}
+
+/**
+ * This function returns the storage activity status.
+ * 
+ * @return true if the page buffer is waiting to be written into the NVM
+ */
+bool StorageIsBusy(void){
+    return flushPending;
+}
+
+/**
+ * This function restores the PARAMETER registers from the storage.
+ * 
+ * The function shall be called after the default value of all 
+ * the PARAMETER registers has been assigned.
+ * 
+ * If the storage image is valid, the stored content 
+ * is assigned to every stored PARAMETER register accepted by the validation callback:
+ * a rejected register keeps the default value, that replaces the stored content.
+ * An image with less registers than PROTO_PARAM_REGISTERS_NUM
+ * (registers appended by a new firmware release) is still valid: 
+ * the appended registers keep the default value and are added to the image.
+ * 
+ * If the storage image is not valid (first startup or format change)
+ * the current content of the PARAMETER registers is stored. 
+ * 
+ * @param validate: this is the validation callback of a restored register
+ * @return true if the PARAMETER registers have been restored
+ */
+bool StorageRestoreParameters(STORAGE_VALIDATE_CALLBACK validate){
+    uint8_t d[4];
+    uint8_t num = 0;
+    bool valid = false;
+    bool rejected = false;
+    
+    if(!storageAvailable) return false;
+    
+    // Validates the storage image
+    if( (storageImage->signature == STORAGE_SIGNATURE) && 
+        (storageImage->version == STORAGE_VERSION) && 
+        (storageImage->num <= PROTO_PARAM_REGISTERS_NUM) && 
+        (storageImage->crc == storageCrc(storageImage->num)) ){
+        
+        num = storageImage->num;
+        valid = true;
+        for(int i = 0; i < num; i++){
+            for(int j = 0; j < 4; j++) d[j] = storageImage->param[i][j];
+            
+            // The rejected content keeps the default value
+            if(validate(i, d)) MET_Can_Protocol_SetDefaultParameter(i, d[0], d[1], d[2], d[3]);
+            else rejected = true;
+        }
+        if((num == PROTO_PARAM_REGISTERS_NUM) && (!rejected)) return true;
+    }
+    
+    // Not valid, shorter image or rejected registers: the current content is stored
+    storageWaitReady();
+    storageImage->signature = STORAGE_SIGNATURE;
+    storageImage->version = STORAGE_VERSION;
+    storageImage->num = PROTO_PARAM_REGISTERS_NUM;
+    for(int i = 0; i < PROTO_PARAM_REGISTERS_NUM; i++){
+        for(int j = 0; j < 4; j++) d[j] = MET_Can_Protocol_GetParameter(i,j);
+        StorageWriteParameter(i, d);
+    }
+    
+    // The header is changed anyway
+    storageImage->crc = storageCrc(PROTO_PARAM_REGISTERS_NUM);
+    flushPending = true;
+    
+    return valid;
+}
+
+/**
+ * This function stores the content of a PARAMETER register.
+ * 
+ * Only the changed bytes are written into the page buffer,
+ * then the CRC is updated and the flush is scheduled.
+ * The function waits the SmartEEPROM ready before writing (see storageWaitReady()).
+ * 
+ * @param idx: this is the PARAMETER register index
+ * @param d: this is the register content
+ */
+void StorageWriteParameter(uint8_t idx, const uint8_t* d){
+    bool changed = false;
+    
+    if(!storageAvailable) return;
+    if(idx >= PROTO_PARAM_REGISTERS_NUM) return;
+    
+    for(int i = 0; i < 4; i++){
+        if(storageImage->param[idx][i] == d[i]) continue;
+        if(!changed) storageWaitReady();
+        storageImage->param[idx][i] = d[i];
+        changed = true;
+    }
+    if(!changed) return;
+    
+    storageImage->crc = storageCrc(PROTO_PARAM_REGISTERS_NUM);
+    flushPending = true;
+}
+
+/**
+ * This function returns the SmartEEPROM availability.
+ * 
+ * @return true if the SmartEEPROM is enabled and configured
+ */
+bool StorageIsAvailable(void){
+    return storageAvailable;
+}
+
+/**
+ * This function reads the firmware update state word.
+ * 
+ * @return the stored word (0 if the SmartEEPROM is not available)
+ */
+uint32_t StorageReadUpdateState(void){
+    if(!storageAvailable) return 0;
+    return *updateState;
+}
+
+/**
+ * This function stores the firmware update state word.
+ * 
+ * Unlike the PARAMETER registers, the word is flushed into the NVM
+ * before returning: the caller can reset the device immediately after.
+ * The function can be called before the scheduler starts.
+ * 
+ * @param state: this is the word to be stored
+ */
+void StorageWriteUpdateState(uint32_t state){
+    if(!storageAvailable) return;
+    if(*updateState == state) return;
+    
+    storageWaitReady();
+    *updateState = state;
+    while(NVMCTRL_SmartEEPROM_IsBusy());
+    NVMCTRL_SmartEEPROMFlushPageBuffer();
+    while(NVMCTRL_SmartEEPROM_IsBusy());
+}
@@ -0,0 +1,124 @@
+#ifndef _STORAGE_H    
+#define _STORAGE_H
+
+#include "definitions.h"  
+#include "application.h"  
+
+#undef ext
+#undef ext_static
+
+#ifdef _STORAGE_C
+    #define ext
+    #define ext_static static 
+#else
+    #define ext extern
+    #define ext_static extern
+#endif
+
+/*!
+ * \defgroup storageModule Parameter persistent storage module
+ *
+ * \ingroup applicationModule
+ * 
+ * 
+ * This Module stores the content of the protocol PARAMETER registers 
+ * into the SmartEEPROM, so that the calibration downloaded by the Host
+ * survives a power cycle.
+ * 
+ * ## Dependencies
+ * 
+ * - NVMCTRL module (SmartEEPROM API);
+ * 
+ * ## Harmony 3 configurator setting
+ * 
+ * The SmartEEPROM is enabled with the User Row configuration bits:
+ * - NVMCTRL_SEESBLK = 0x1: one 8KB block for every SmartEEPROM sector;
+ * - NVMCTRL_SEEPSZ = 0x1: 8 bytes SmartEEPROM page;
+ * 
+ * The resulting virtual size is 512 bytes, mapped at SEEPROM_ADDR.
+ * 
+ * ## Module Function Description
+ * 
+ * The storage image is made of an header (signature, format version and
+ * number of stored registers), the content of every PARAMETER register
+ * and a CRC16-CCITT of all the previous bytes.
+ * 
+ * At the startup StorageRestoreParameters() validates the image: 
+ * if the signature, the version and the CRC are correct 
+ * the stored content replaces the default value of every PARAMETER register.
+ * Every restored register is validated with the same hook applied to 
+ * the Host writes (see ApplicationProtocolParameterHandler()): 
+ * a rejected content (i.e. an image of an older firmware) keeps the default value,
+ * that is stored in place of the rejected one.
+ * If the image is not valid, the default content is stored instead.
+ * New PARAMETER registers shall be appended to the list: an image 
+ * with less registers is restored and the appended registers are added
+ * with their default value. 
+ * 
+ * StorageWriteParameter() is called every time a PARAMETER register 
+ * is accepted by the protocol module: the SmartEEPROM works in buffered mode,
+ * so the new content and the new CRC are collected in the page buffer 
+ * and the page buffer flush is postponed to the StorageLoop() routine. 
+ * The page buffer is written only when the SmartEEPROM is not busy: 
+ * a full active sector is reallocated before the write.
+ * 
+ * The word at STORAGE_UPDATE_OFFSET holds the firmware update state
+ * (see \ref updateModule): it is not part of the image and it is written
+ * with an immediate flush by StorageWriteUpdateState(), so that it survives
+ * the reset following the write.
+ * 
+ *  @{
+ * 
+ */
+
+     /**
+    * \defgroup storageApiModule API Module
+    *  @{
+    */
+        
+        /// Validation of a restored PARAMETER register: returns true if the content is accepted
+        typedef bool (*STORAGE_VALIDATE_CALLBACK)(uint8_t idx, uint8_t* d);
+        
+        ext void StorageInit(void);
+        ext void StorageLoop(void);
+        ext bool StorageIsBusy(void);
+        ext bool StorageIsAvailable(void);
+        ext bool StorageRestoreParameters(STORAGE_VALIDATE_CALLBACK validate);
+        ext void StorageWriteParameter(uint8_t idx, const uint8_t* d);
+        ext uint32_t StorageReadUpdateState(void);
+        ext void StorageWriteUpdateState(uint32_t state);
+        
+    /** @}*/ // storageApiModule
+        
+    /**
+    * \defgroup storageMacroModule Module's Macros
+    *  @{
+    */
+        
+        #define STORAGE_SIGNATURE   0x4D45      //!< Image signature
+        #define STORAGE_VERSION     1           //!< Image format version: change it when the stored registers change meaning (not when registers are appended)
+        #define STORAGE_MAX_PARAMS  32          //!< Max number of storable PARAMETER registers
+        #define STORAGE_UPDATE_OFFSET 256       //!< SmartEEPROM offset of the firmware update state word (after the image)
+        
+    /** @}*/ // storageMacroModule
+
+     /**
+    * \defgroup storageStructModule Module Data structures
+    *  @{
+    */
+        
+    /// This is the image of the storage area in the SmartEEPROM
+    typedef struct{
+        uint16_t signature; //!< Image signature (STORAGE_SIGNATURE)
+        uint8_t  version;   //!< Image format version (STORAGE_VERSION)
+        uint8_t  num;       //!< Number of stored PARAMETER registers
+        uint8_t  param[STORAGE_MAX_PARAMS][4]; //!< PARAMETER registers content
+        uint16_t crc;       //!< CRC16-CCITT of the previous fields
+    }STORAGE_IMAGE_t;
+    
+    /** @}*/ // storageStructModule
+         
+/** @}*/ // storageModule
+        
+        
+#endif 
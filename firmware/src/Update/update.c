@@ -0,0 +1,314 @@
+#define _UPDATE_C
+
+#include "application.h"
+#include "update.h"
+#include "Protocol/protocol.h"
+#include "Storage/storage.h"
+#include "History/history.h"
+#include "Filter/filter.h"
+
+#define UPDATE_PAGE_WORDS   (NVMCTRL_FLASH_PAGESIZE / 4)    //!< Words of a flash page
+
+static UPDATE_STATUS_ENUM_t updateStatus = UPDATE_IDLE; //!< Module status
+static uint32_t pageBuffer[UPDATE_PAGE_WORDS];  //!< Page image to be written
+static bool     pagePending;    //!< The page buffer is waiting to be written
+static uint32_t imageLength;    //!< Image length (bytes)
+static uint32_t imageReceived;  //!< Received image bytes
+static uint32_t imageCrc;       //!< Expected image CRC32
+static uint32_t nvmAddress;     //!< Next block to be erased, page to be written or page to be verified (inactive bank)
+static uint32_t nvmEnd;         //!< End of the erase or verify range
+static uint32_t verifyCrc;      //!< Running CRC32 of the verified image bytes
+static bool     trialActive;    //!< The running image is in trial
+static uint8_t  trialBoots;     //!< Trial startups of the running image
+static TickType_t trialStart;   //!< Tick of the trial start (scheduler start)
+
+/**
+ * This function updates the CRC32 (IEEE 802.3, reflected) with the flash content.
+ *
+ * @param address: this is the first byte address
+ * @param len: this is the number of bytes
+ */
+static void updateCrc(uint32_t address, uint32_t len){
+    const uint8_t* pData = (const uint8_t*) address;
+
+    for(uint32_t i = 0; i < len; i++){
+        verifyCrc ^= pData[i];
+        for(int j = 0; j < 8; j++){
+            if(verifyCrc & 1) verifyCrc = (verifyCrc >> 1) ^ 0xEDB88320;
+            else verifyCrc = verifyCrc >> 1;
+        }
+    }
+}
+
+/**
+ * This function enables the WDT for the trial supervision.
+ *
+ * The WDT is clocked by the 1KHz ULP oscillator and runs in STANDBY:
+ * the period is 8s, while the Protocol task runs at least every POWER_STANDBY_POLL ms.
+ */
+static void updateWatchdogEnable(void){
+    WDT_REGS->WDT_CTRLA = 0;
+    while(WDT_REGS->WDT_SYNCBUSY & WDT_SYNCBUSY_ENABLE_Msk);
+    WDT_REGS->WDT_CONFIG = WDT_CONFIG_PER_CYC8192;
+    WDT_REGS->WDT_CTRLA = WDT_CTRLA_ENABLE_Msk;
+    while(WDT_REGS->WDT_SYNCBUSY & WDT_SYNCBUSY_ENABLE_Msk);
+}
+
+/**
+ * This function starts the trial supervision at the reset.
+ *
+ * The function is called by the reset handler hook (_on_reset()), 
+ * before the C runtime and the clock initialization: the WDT supervises 
+ * the whole startup of an image in trial, and a startup stopped 
+ * before the UpdateInit() is counted as a trial startup as well.
+ * 
+ * No RAM variable can be used here: the state word is accessed directly 
+ * in the SmartEEPROM (unbuffered write mode after the reset).
+ */
+void UpdateResetHook(void){
+    volatile uint32_t* state = (volatile uint32_t*) (SEEPROM_ADDR + STORAGE_UPDATE_OFFSET);
+    
+    // The SmartEEPROM is disabled if no block is assigned to the sectors
+    if((NVMCTRL_REGS->NVMCTRL_SEESTAT & NVMCTRL_SEESTAT_SBLK_Msk) == 0) return;
+    while(NVMCTRL_REGS->NVMCTRL_SEESTAT & NVMCTRL_SEESTAT_BUSY_Msk);
+    
+    uint32_t word = *state;
+    if((word >> 16) != UPDATE_STATE_SIGNATURE) return;
+    if((word & UPDATE_STATE_TRIAL) == 0) return;
+    
+    updateWatchdogEnable();
+    
+    // Trial boot counter (saturated)
+    if(((word >> 8) & 0xFF) != 0xFF){
+        *state = word + (1 << 8);
+        while(NVMCTRL_REGS->NVMCTRL_SEESTAT & NVMCTRL_SEESTAT_BUSY_Msk);
+    }
+}
+
+/**
+ * Module initialization.
+ *
+ * The function shall be called after the ApplicationProtocolInit()
+ * (SmartEEPROM initialization) and before the other modules:
+ * in case of rollback the device is reset.
+ *
+ * - Image committed: nothing to do;
+ * - Image in trial: the trial boot counter (incremented by the UpdateResetHook()) is read,
+ *   the WDT is already running;
+ * - Trial boots exhausted: the trial state is cleared and the banks are swapped back.
+ */
+void UpdateInit(void){
+    updateStatus = UPDATE_IDLE;
+    pagePending = false;
+    trialActive = false;
+    trialBoots = 0;
+
+    uint32_t state = StorageReadUpdateState();
+    if((state >> 16) != UPDATE_STATE_SIGNATURE) return;
+    if((state & UPDATE_STATE_TRIAL) == 0) return;
+
+    trialBoots = (uint8_t) (state >> 8);
+    if(trialBoots > UPDATE_TRIAL_BOOTS){
+        // Rollback: the previous image is still in the inactive bank
+        HistorySnapshotMigrate();
+        StorageWriteUpdateState((uint32_t) UPDATE_STATE_SIGNATURE << 16);
+        NVMCTRL_BankSwap();
+        while(true);
+    }
+
+    trialActive = true;
+    trialStart = 0;
+}
+
+/**
+ * This function shall be called by the Protocol task.
+ *
+ * The function supervises the trial of a new image and proceeds
+ * with the download: at most one NVM operation is started for every call.
+ */
+void UpdateLoop(void){
+
+    // Trial supervision: the WDT is cleared as long as the Protocol task runs
+    if(trialActive){
+        if((WDT_REGS->WDT_SYNCBUSY & WDT_SYNCBUSY_CLEAR_Msk) == 0) WDT_REGS->WDT_CLEAR = WDT_CLEAR_CLEAR_KEY_Val;
+
+        if((xTaskGetTickCount() - trialStart) >= pdMS_TO_TICKS(UPDATE_HEALTH_TIME * 1000)){
+            // Commit
+            StorageWriteUpdateState((uint32_t) UPDATE_STATE_SIGNATURE << 16);
+            WDT_REGS->WDT_CTRLA = 0;
+            trialActive = false;
+            trialBoots = 0;
+        }
+    }
+
+    if(updateStatus == UPDATE_IDLE) return;
+    if(NVMCTRL_IsBusy() || NVMCTRL_SmartEEPROM_IsBusy()) return;
+
+    switch(updateStatus){
+        case UPDATE_ERASE:
+            NVMCTRL_BlockErase(nvmAddress);
+            nvmAddress += NVMCTRL_FLASH_BLOCKSIZE;
+            if(nvmAddress >= nvmEnd){
+                nvmAddress = UPDATE_BANK_SIZE;
+                updateStatus = UPDATE_BOOT_COPY;
+            }
+            break;
+
+        case UPDATE_BOOT_COPY:
+            // The running bootloader is copied page by page (the source is the executing bank)
+            for(int i = 0; i < UPDATE_PAGE_WORDS; i++){
+                pageBuffer[i] = ((volatile const uint32_t*) (nvmAddress - UPDATE_BANK_SIZE))[i];
+            }
+            NVMCTRL_PageWrite(pageBuffer, nvmAddress);
+            nvmAddress += NVMCTRL_FLASH_PAGESIZE;
+            if(nvmAddress >= UPDATE_BANK_SIZE + UPDATE_IMAGE_ORIGIN) updateStatus = UPDATE_RECEIVE;
+            break;
+
+        case UPDATE_RECEIVE:
+            if(!pagePending) break;
+            NVMCTRL_PageWrite(pageBuffer, nvmAddress);
+            nvmAddress += NVMCTRL_FLASH_PAGESIZE;
+            pagePending = false;
+            break;
+
+        case UPDATE_VERIFY:
+            // The padding of the last page is not included
+            if(nvmEnd - nvmAddress > NVMCTRL_FLASH_PAGESIZE){
+                updateCrc(nvmAddress, NVMCTRL_FLASH_PAGESIZE);
+                nvmAddress += NVMCTRL_FLASH_PAGESIZE;
+                break;
+            }
+            updateCrc(nvmAddress, nvmEnd - nvmAddress);
+
+            updateStatus = (~verifyCrc == imageCrc) ? UPDATE_SWAP : UPDATE_IDLE;
+            break;
+
+        case UPDATE_SWAP:
+            // The swap waits the command response transmission and the end of the NVM and motor activities
+            if(ApplicationProtocolIsBusy() || HistoryIsBusy() || FilterIsRunning()) break;
+
+            // The history snapshot is moved to the bank becoming inactive
+            HistorySnapshotMigrate();
+
+            // The trial state is stored just before the swap: the new image starts the trial
+            StorageWriteUpdateState(((uint32_t) UPDATE_STATE_SIGNATURE << 16) | UPDATE_STATE_TRIAL);
+            NVMCTRL_BankSwap();
+            while(true);
+
+        default:
+            updateStatus = UPDATE_IDLE;
+    }
+}
+
+/**
+ * This function starts a download (UPDATE_START command).
+ *
+ * @param length: this is the image length (bytes)
+ * @return true if the download is started
+ */
+bool UpdateStart(uint32_t length){
+    if(trialActive) return false;
+    
+    // Without the SmartEEPROM the trial state can't be stored: 
+    // the new image would start as committed, without supervision
+    if(!StorageIsAvailable()) return false;
+    if((length == 0) || (length > UPDATE_IMAGE_MAX) || (length & 0x3)) return false;
+    if((updateStatus == UPDATE_VERIFY) || (updateStatus == UPDATE_SWAP)) return false;
+
+    imageLength = length;
+    imageReceived = 0;
+    pagePending = false;
+    nvmAddress = UPDATE_BANK_SIZE;
+    nvmEnd = UPDATE_BANK_SIZE + UPDATE_IMAGE_ORIGIN + length;
+    updateStatus = UPDATE_ERASE;
+    return true;
+}
+
+/**
+ * This function stores the next 4 bytes of the image (UPDATE_DATA and UPDATE_DATA_ODD commands).
+ *
+ * When the page buffer is full (or the image is complete)
+ * the page is written by the UpdateLoop().
+ * 
+ * A word with the parity of the last received word is not the expected word:
+ * it is a repetition after a lost answer, and it is not stored again.
+ *
+ * @param d: this is the pointer to the 4 data bytes
+ * @param odd: this is the word parity of the command (UPDATE_DATA_ODD)
+ * @return true if the bytes are stored or not expected (see UpdateGetReceived())
+ */
+bool UpdateData(const uint8_t* d, bool odd){
+    if((updateStatus != UPDATE_RECEIVE) || pagePending) return false;
+    
+    // Sequence check: the expected parity is the parity of the received words
+    if(odd != (((imageReceived / 4) & 1) != 0)) return true;
+    
+    if(imageReceived >= imageLength) return false;
+
+    uint32_t idx = (imageReceived % NVMCTRL_FLASH_PAGESIZE) / 4;
+    pageBuffer[idx] = (uint32_t) d[0] | ((uint32_t) d[1] << 8) | ((uint32_t) d[2] << 16) | ((uint32_t) d[3] << 24);
+    imageReceived += 4;
+
+    if((idx == UPDATE_PAGE_WORDS - 1) || (imageReceived == imageLength)){
+        for(idx++; idx < UPDATE_PAGE_WORDS; idx++) pageBuffer[idx] = 0xFFFFFFFF;
+        pagePending = true;
+    }
+    return true;
+}
+
+/**
+ * This function starts the verification of the received image (UPDATE_ACTIVATE command).
+ *
+ * @param crc: this is the CRC32 of the image
+ * @return true if the image is complete and the verification is started
+ */
+bool UpdateActivate(uint32_t crc){
+    if((updateStatus != UPDATE_RECEIVE) || pagePending) return false;
+    if(imageReceived != imageLength) return false;
+
+    imageCrc = crc;
+    verifyCrc = 0xFFFFFFFF;
+    nvmAddress = UPDATE_BANK_SIZE + UPDATE_IMAGE_ORIGIN;
+    updateStatus = UPDATE_VERIFY;
+    return true;
+}
+
+/**
+ * This function discards the download in progress.
+ *
+ * A verified image waiting for the bank swap is not discarded.
+ */
+void UpdateAbort(void){
+    if(updateStatus == UPDATE_SWAP) return;
+    updateStatus = UPDATE_IDLE;
+    pagePending = false;
+}
+
+/**
+ * This function returns the module activity status.
+ *
+ * @return true if an NVM operation is pending
+ */
+bool UpdateIsBusy(void){
+    if(updateStatus == UPDATE_RECEIVE) return pagePending;
+    return (updateStatus != UPDATE_IDLE);
+}
+
+UPDATE_STATUS_ENUM_t UpdateGetStatus(void){
+    return updateStatus;
+}
+
+uint32_t UpdateGetReceived(void){
+    return imageReceived;
+}
+
+/**
+ * This function returns the trial status of the running image.
+ *
+ * @return the trial boot counter (0 if committed) | 0x80 if the bank A is executing
+ */
+uint8_t UpdateGetTrialStatus(void){
+    uint8_t status = (trialActive) ? trialBoots : 0;
+    if(NVMCTRL_REGS->NVMCTRL_STATUS & NVMCTRL_STATUS_AFIRST_Msk) status |= 0x80;
+    return status;
+}
@@ -0,0 +1,157 @@
+#ifndef _UPDATE_H
+#define _UPDATE_H
+
+#include "definitions.h"
+#include "application.h"
+
+#undef ext
+#undef ext_static
+
+#ifdef _UPDATE_C
+    #define ext
+    #define ext_static static
+#else
+    #define ext extern
+    #define ext_static extern
+#endif
+
+/*!
+ * \defgroup updateModule Dual bank firmware update module
+ *
+ * \ingroup applicationModule
+ *
+ *
+ * This Module writes a new firmware image into the flash bank not executing the code
+ * while the application keeps serving the protocol, and activates it with a bank swap.
+ * The downtime of an update is a single reboot: the bootloader is not involved.
+ *
+ * ## Dependencies
+ *
+ * - NVMCTRL module (block erase, page write and bank swap);
+ * - WDT module (supervision of the first run of a new image);
+ * - \ref storageModule (update state word in the SmartEEPROM);
+ *
+ * ## Linker setting
+ *
+ * The application ROM shall fit a single bank: ROM_LENGTH = 0x76000,
+ * so the image ends at 0x78000. The top 32KB of every bank are left to the data:
+ * the SmartEEPROM sectors and the history snapshot block (see \ref historyModule)
+ * at the top of the inactive bank are never written by the download.
+ * The bank swap exchanges the snapshot block with the same block of the active bank:
+ * before every swap (activation and rollback) HistorySnapshotMigrate() copies
+ * the snapshot into the active bank, so the history is kept and a stale snapshot
+ * left by an older image is never restored.
+ *
+ * ## Module Function Description
+ *
+ * ### Download
+ *
+ * The image is the application ROM content from ROM_ORIGIN (bootloader table included).
+ *
+ * - UPDATE_START (d0..d2 = image length in bytes, little endian, multiple of 4):
+ *   the command fails if the SmartEEPROM is not available (the trial state can't be stored).
+ *   The blocks of the inactive bank up to the image end are erased and the running
+ *   bootloader is copied into the first block, so the inactive bank becomes a complete
+ *   boot image. The command completes when the bank is ready;
+ * - UPDATE_DATA / UPDATE_DATA_ODD (d0..d3 = next 4 image bytes): the bytes are collected in a page buffer.
+ *   The Host sends the even words (0, 2, 4..) with UPDATE_DATA and the odd words with UPDATE_DATA_ODD.
+ *   A full page is written by the UpdateLoop() and in the meantime the command
+ *   is answered MET_CAN_COMMAND_BUSY. The command returns the number of received words
+ *   (d0..d1, modulo 65536), that is the index of the next expected word;
+ * - UPDATE_ACTIVATE (d0..d3 = CRC32 of the image, little endian): the image is read back
+ *   from the inactive bank and its CRC32 (IEEE 802.3, the bootloader CRC) is verified,
+ *   one page per UpdateLoop() call. If the CRC matches the command completes,
+ *   then the history snapshot is migrated, the trial state is stored and the banks
+ *   are swapped as soon as the response has been transmitted and the motor is stopped. Otherwise the command fails
+ *   with COMMAND_ERROR_UPDATE_CRC;
+ * - MET_COMMAND_ABORT: the download is discarded (the active bank is never affected).
+ *
+ * The parity of the data command is the sequence check of the word (alternating bit).
+ * A word with the wrong parity is not stored and the command returns the index 
+ * of the expected word as usual:
+ * - a word repeated after a lost answer gets the same answer again (idempotent);
+ * - the Host shall continue from the returned index when it differs from its next word.
+ *
+ * The NVM is written by the Protocol task, one operation per UpdateLoop() call,
+ * so the protocol response time is not affected: the bank being written
+ * is not the bank executing the code, so the CPU is never stalled.
+ *
+ * ### Health check and rollback
+ *
+ * The first runs of a new image are a trial: at every startup in trial state
+ * the UpdateResetHook(), called by the reset handler before the C runtime 
+ * and the clock initialization, increments the trial boot counter and enables the WDT,
+ * cleared by the Protocol task at every UpdateLoop() call.
+ * An image that stops serving the protocol, or that hangs in its startup, is reset by the WDT.
+ *
+ * After UPDATE_HEALTH_TIME seconds of regular operation the image is committed:
+ * the trial state is cleared and the WDT is disabled.
+ * If the image does not reach the commit within UPDATE_TRIAL_BOOTS startups
+ * the banks are swapped back and the previous image is restored.
+ *
+ * The trial is handled by the new image: an image without this module
+ * is never rolled back. A power cycle during the trial counts as a trial startup.
+ *
+ * GET_UPDATE_STATUS returns d0 = module status (UPDATE_STATUS_ENUM_t),
+ * d1 = trial boot counter (0 if the image is committed) | 0x80 if the bank A is executing.
+ *
+ *  @{
+ *
+ */
+
+     /**
+    * \defgroup updateStructModule Module Data structures
+    *  @{
+    */
+
+    /// This is the module status
+    typedef enum{
+        UPDATE_IDLE = 0,    //!< No download in progress
+        UPDATE_ERASE,       //!< The inactive bank is being erased
+        UPDATE_BOOT_COPY,   //!< The bootloader is being copied into the inactive bank
+        UPDATE_RECEIVE,     //!< The image is being received
+        UPDATE_VERIFY,      //!< The image CRC is being verified
+        UPDATE_SWAP,        //!< The image is verified: the bank swap is pending
+    }UPDATE_STATUS_ENUM_t;
+
+    /** @}*/ // updateStructModule
+
+     /**
+    * \defgroup updateApiModule API Module
+    *  @{
+    */
+
+        ext void UpdateResetHook(void);
+        ext void UpdateInit(void);
+        ext void UpdateLoop(void);
+        ext bool UpdateStart(uint32_t length);
+        ext bool UpdateData(const uint8_t* d, bool odd);
+        ext bool UpdateActivate(uint32_t crc);
+        ext void UpdateAbort(void);
+        ext bool UpdateIsBusy(void);
+        ext UPDATE_STATUS_ENUM_t UpdateGetStatus(void);
+        ext uint32_t UpdateGetReceived(void);
+        ext uint8_t UpdateGetTrialStatus(void);
+
+    /** @}*/ // updateApiModule
+
+    /**
+    * \defgroup updateMacroModule Module's Macros
+    *  @{
+    */
+
+        #define UPDATE_BANK_SIZE        0x80000     //!< Flash bank size: the inactive bank is mapped at this address
+        #define UPDATE_IMAGE_ORIGIN     0x2000      //!< Image start address (ROM_ORIGIN)
+        #define UPDATE_IMAGE_MAX        0x76000     //!< Max image length (ROM_LENGTH)
+        #define UPDATE_HEALTH_TIME      60          //!< Regular operation time (s) to commit a new image
+        #define UPDATE_TRIAL_BOOTS      3           //!< Max startups of a new image before the rollback
+
+        #define UPDATE_STATE_SIGNATURE  0x5550      //!< Update state word: signature (bits 16..31)
+        #define UPDATE_STATE_TRIAL      0x1         //!< Update state word: trial flag (bit 0); bits 8..15 = trial boot counter
+
+    /** @}*/ // updateMacroModule
+
+/** @}*/ // updateModule
+
+
+#endif
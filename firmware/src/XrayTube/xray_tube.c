@@ -3,159 +3,528 @@
 #include "application.h"
 #include "xray_tube.h"
 #include "Protocol/protocol.h" 
+#include "History/history.h"
+#include "Profiler/profiler.h"
 
 #define FAN_ON uc_FAN_Clear()
 #define FAN_OFF uc_FAN_Set()
+#define FAN_PWM_PERIOD 100  //!< TC0 PWM period (TC0 PER + 1): the duty cycle is set in 1% steps
+
+#define ADC_RING_DIM 16     //!< Number of samples of the ADC ring buffers
+#define ADC_RING_SHIFT 4    //!< Log2 of ADC_RING_DIM: the filtered result keeps the 12 bit scale 
+
+#define SENSOR_OPEN_LIMIT 1136  //!< Below this level the sensor is open (12 bit): ADC WINLT
+#define SENSOR_SHORT_LIMIT 3360 //!< Above this level the sensor is in short (12 bit): ADC WINUT
 
 static unsigned char statorPerc;
 static unsigned char bulbPerc;
+static int16_t statorTemp; //!< Stator temperature (0.1C)
+static int16_t bulbTemp;   //!< Bulb temperature (0.1C)
 static unsigned char XrayFanDutyCycle;
-static void XrayFanManagement(TC_COMPARE_STATUS status, uintptr_t context);
+static void XrayFanSetDuty(unsigned char duty);
 
-/*
- * Lookup Table 
-|	71	|	0	|
-|	78	|	5	|
-|	85	|	10	|
-|	92	|	15	|
-|	100	|	20	|
-|	107	|	25	|
-|	114	|	30	|
-|	121	|	35	|
-|	127	|	40	|
-|	134	|	45	|
-|	140	|	50	|
-|	146	|	55	|
-|	151	|	60	|
-|	156	|	65	|
-|	161	|	70	|
-|	166	|	75	|
-|	170	|	80	|
-|	174	|	85	|
-|	178	|	90	|
-|	181	|	95	|
-|	184	|	100	|
-|	187	|	105	|
+#define FAN_HISTORY_DIM 32  //!< Temperature history for the rate of rise: 32 x 125ms = 4s
+#define FAN_HISTORY_HALF (FAN_HISTORY_DIM / 2)
+#define FAN_TARGET_MIN 20   //!< Min Fan target temperature (C)
+#define FAN_TARGET_MAX 85   //!< Max Fan target temperature (C)
+#define FAN_KP 26214        //!< Proportional gain (Q16, duty % per 0.1C): 4% per C
+#define FAN_KI 41           //!< Integral gain (Q16, duty % per 0.1C per control period): 0.05% per C per second
+#define FAN_KFF 655360      //!< Feed-forward gain (Q16, duty % per 0.1C/s): 100% per C/s
+#define FAN_STEP_MAX 30     //!< Max temperature change in a control period (0.1C): a larger change is a sensor step, not a heat-up
+#define FAN_FILTER_SHIFT 3  //!< Temperature low-pass filter: 8 x 125ms = 1s time constant
+#define FAN_Q16(x) ((int32_t)(x) << 16)
+
+static int16_t fanTarget;           //!< Fan target temperature (0.1C)
+static unsigned char fanMinDuty;    //!< Min duty cycle with the FAN running (%)
+static unsigned char fanMaxDuty;    //!< Max duty cycle (%)
+static int32_t fanIntegral;         //!< Integral term (Q16 duty %)
+static int32_t fanHistory[FAN_HISTORY_DIM]; //!< Last 4 seconds filtered temperatures (0.1C, Q8)
+static uint8_t fanHistoryIndex;
+static bool fanHistoryValid;
+static bool fanRunning;             //!< The FAN is running (cut-in/cut-out hysteresis)
+static int32_t fanFiltered;         //!< Low-pass filtered temperature (0.1C, Q8)
+static int16_t fanLastTemp;         //!< Last not filtered temperature (0.1C)
+
+static volatile uint16_t statorRing[ADC_RING_DIM]; //!< Stator sensor samples written by the DMAC channel 0
+static volatile uint16_t bulbRing[ADC_RING_DIM];   //!< Bulb sensor samples written by the DMAC channel 1
+static dmac_descriptor_registers_t statorDescriptor __ALIGNED(16);
+static dmac_descriptor_registers_t bulbDescriptor __ALIGNED(16);
+
+/**
+ * This function starts the DMA transfer of the ADC results into a ring buffer.
+ * 
+ * The descriptor is linked to itself so the DMAC channel 
+ * fills the ring buffer endlessly, without any CPU intervention.
+ * 
+ * @param channel: this is the DMAC channel triggered by the ADC RESRDY
+ * @param desc: this is the descriptor of the channel
+ * @param result: this is the ADC RESULT register
+ * @param ring: this is the ring buffer
+ */
+static void adcRingStart(DMAC_CHANNEL channel, dmac_descriptor_registers_t* desc, const volatile uint16_t* result, volatile uint16_t* ring){
+    desc->DMAC_BTCTRL = DMAC_BTCTRL_BLOCKACT_NOACT | DMAC_BTCTRL_BEATSIZE_HWORD | DMAC_BTCTRL_VALID_Msk | DMAC_BTCTRL_DSTINC_Msk;
+    desc->DMAC_BTCNT = ADC_RING_DIM;
+    desc->DMAC_SRCADDR = (uint32_t) result;
+    desc->DMAC_DSTADDR = (uint32_t) (ring + ADC_RING_DIM); // With DSTINC the address is the end of the block
+    desc->DMAC_DESCADDR = (uint32_t) desc;
+    DMAC_ChannelLinkedListTransfer(channel, desc);
+}
+
+/**
+ * This is the ADC0 window monitor callback (Stator sensor).
+ * 
+ * The ADC0 is set in window mode with the open and short limits:
+ * a result out of the window sets the sensor error immediately.
+ * 
+ * The window interrupt is then disabled until the XrayLoop()
+ * detects the sensor back in the valid range, preventing 
+ * an interrupt every conversion for the whole fault duration.
+ * 
+ * @param status: this is the ADC interrupt status
+ * @param context: not used
+ */
+static void statorWindowCallback(ADC_STATUS status, uintptr_t context){
+    if(!(status & ADC_STATUS_WINMON)) return;
+    
+    ADC0_InterruptsDisable(ADC_STATUS_WINMON);
+    if(ADC0_ConversionResultGet() < SENSOR_OPEN_LIMIT) setStatorErrorLow(true);
+    else setStatorErrorShort(true);
+}
+
+/**
+ * This is the ADC1 window monitor callback (Bulb sensor).
+ * 
+ * See statorWindowCallback().
+ * 
+ * @param status: this is the ADC interrupt status
+ * @param context: not used
+ */
+static void bulbWindowCallback(ADC_STATUS status, uintptr_t context){
+    if(!(status & ADC_STATUS_WINMON)) return;
+    
+    ADC1_InterruptsDisable(ADC_STATUS_WINMON);
+    if(ADC1_ConversionResultGet() < SENSOR_OPEN_LIMIT) setBulbErrorLow(true);
+    else setBulbErrorShort(true);
+}
+
+/**
+ * This function returns the decimated value of a ring buffer.
+ * 
+ * Every sample is already the hardware average of 16 conversions (AVGCTRL):
+ * the mean of the whole ring buffer provides a 12 bit result.
+ * 
+ * @param ring: this is the ring buffer
+ * @return the filtered 12 bit value
  */
+static uint16_t adcRingFilter(volatile uint16_t* ring){
+    uint32_t sum = 0;
+    
+    for(int i = 0; i < ADC_RING_DIM; i++) sum += ring[i];
+    return (uint16_t) (sum >> ADC_RING_SHIFT);
+}
+
 void XrayInit(void){
     FAN_OFF;
     XrayFanDutyCycle = 0;
+    fanIntegral = 0;
+    fanHistoryIndex = 0;
+    fanHistoryValid = false;
+    fanRunning = false;
+    if(!XrayFanSetControl(GETBYTE_PARAMETER_FAN_TARGET_TEMP, GETBYTE_PARAMETER_FAN_MIN_DUTY, GETBYTE_PARAMETER_FAN_MAX_DUTY)){
+        XrayFanSetControl(50, 20, 100);
+    }
+    
+    adcRingStart(DMAC_CHANNEL_0, &statorDescriptor, &ADC0_REGS->ADC_RESULT, statorRing);
+    adcRingStart(DMAC_CHANNEL_1, &bulbDescriptor, &ADC1_REGS->ADC_RESULT, bulbRing);
+    ADC0_CallbackRegister(statorWindowCallback, 0);
+    ADC1_CallbackRegister(bulbWindowCallback, 0);
     ADC0_Enable();
     ADC1_Enable();
     ADC0_ConversionStart();
     ADC1_ConversionStart();
     
+    // The FAN PWM starts with the first duty cycle different from 0%
     TC0_CompareStop();
-    TC0_CompareCallbackRegister(XrayFanManagement, 0);    
-    TC0_Compare8bitPeriodSet(1);   
-    TC0_CompareStart();  
 }
 
-typedef struct{
-    unsigned char sensor;
-    unsigned char perc;
-}lookupT;
-
-
-static const lookupT sensToPerc[] = {
-    {71,0}, //!< 0C
-    {78,0}, //!< 5C
-    {85,0}, //!< 10C
-    {92,0}, //!< 15C
-    {100,0},//!< 20C
-    {107,6},//!< 25C
-    {114,12},//!< 30C
-    {121,18},//!< 35C
-    {127,24},//!< 40C
-    {134,30},//!< 45C
-    {140,36},//!< 50C
-    {146,42},//!< 55C
-    {151,48},//!< 60C
-    {156,54},//!< 65C
-    {161,60},//!< 70C
-    {166,66},//!< 75C
-    {170,72},//!< 80C
-    {174,78},//!< 85C
-    {178,84},//!< 90C
-    {181,90},//!< 95C
-    {184,96},//!< 100C
-    {187,100}//!< 105C
-               
+/*
+ * Sensor calibration points (12 bit ADC code) every 5C
+ */
+#define TEMP_CAL_0      1136    //!< 0C
+#define TEMP_CAL_5      1248    //!< 5C
+#define TEMP_CAL_10     1360    //!< 10C
+#define TEMP_CAL_15     1472    //!< 15C
+#define TEMP_CAL_20     1600    //!< 20C
+#define TEMP_CAL_25     1712    //!< 25C
+#define TEMP_CAL_30     1824    //!< 30C
+#define TEMP_CAL_35     1936    //!< 35C
+#define TEMP_CAL_40     2032    //!< 40C
+#define TEMP_CAL_45     2144    //!< 45C
+#define TEMP_CAL_50     2240    //!< 50C
+#define TEMP_CAL_55     2336    //!< 55C
+#define TEMP_CAL_60     2416    //!< 60C
+#define TEMP_CAL_65     2496    //!< 65C
+#define TEMP_CAL_70     2576    //!< 70C
+#define TEMP_CAL_75     2656    //!< 75C
+#define TEMP_CAL_80     2720    //!< 80C
+#define TEMP_CAL_85     2784    //!< 85C
+#define TEMP_CAL_90     2848    //!< 90C
+#define TEMP_CAL_95     2896    //!< 95C
+#define TEMP_CAL_100    2944    //!< 100C
+#define TEMP_CAL_105    2992    //!< 105C
+
+#define TEMP_TABLE_FIRST_CODE TEMP_CAL_0    //!< ADC code of the first item of the conversion table
+#define TEMP_TABLE_DIM 2048                 //!< Items of the conversion table: codes above TEMP_CAL_105 are saturated
+#define TEMP_MAX 1050                       //!< Max temperature of the conversion table (0.1C)
+
+#define TEMP_PERC_ZERO 200      //!< Temperature (0.1C) corresponding to the 0%
+#define TEMP_PERC_FULL 1033     //!< Temperature (0.1C) corresponding to the 100%: 1.2% per C 
+#define TEMP_HIGH_LIMIT 900     //!< Temperature (0.1C) activating the High temperature error
+
+/*
+ * The conversion table is generated at build time by the preprocessor:
+ * every item is the linear interpolation (0.1C) between the two 
+ * calibration points surrounding the ADC code.
+ */
+#define TEMP_SEGMENT(c, c0, c1, t0) ((t0) * 10 + (50 * ((c) - (c0)) + ((c1) - (c0)) / 2) / ((c1) - (c0)))
+#define CODE_TO_TEMP(c) ( \
+    ((c) < TEMP_CAL_5) ? TEMP_SEGMENT(c, TEMP_CAL_0, TEMP_CAL_5, 0) : \
+    ((c) < TEMP_CAL_10) ? TEMP_SEGMENT(c, TEMP_CAL_5, TEMP_CAL_10, 5) : \
+    ((c) < TEMP_CAL_15) ? TEMP_SEGMENT(c, TEMP_CAL_10, TEMP_CAL_15, 10) : \
+    ((c) < TEMP_CAL_20) ? TEMP_SEGMENT(c, TEMP_CAL_15, TEMP_CAL_20, 15) : \
+    ((c) < TEMP_CAL_25) ? TEMP_SEGMENT(c, TEMP_CAL_20, TEMP_CAL_25, 20) : \
+    ((c) < TEMP_CAL_30) ? TEMP_SEGMENT(c, TEMP_CAL_25, TEMP_CAL_30, 25) : \
+    ((c) < TEMP_CAL_35) ? TEMP_SEGMENT(c, TEMP_CAL_30, TEMP_CAL_35, 30) : \
+    ((c) < TEMP_CAL_40) ? TEMP_SEGMENT(c, TEMP_CAL_35, TEMP_CAL_40, 35) : \
+    ((c) < TEMP_CAL_45) ? TEMP_SEGMENT(c, TEMP_CAL_40, TEMP_CAL_45, 40) : \
+    ((c) < TEMP_CAL_50) ? TEMP_SEGMENT(c, TEMP_CAL_45, TEMP_CAL_50, 45) : \
+    ((c) < TEMP_CAL_55) ? TEMP_SEGMENT(c, TEMP_CAL_50, TEMP_CAL_55, 50) : \
+    ((c) < TEMP_CAL_60) ? TEMP_SEGMENT(c, TEMP_CAL_55, TEMP_CAL_60, 55) : \
+    ((c) < TEMP_CAL_65) ? TEMP_SEGMENT(c, TEMP_CAL_60, TEMP_CAL_65, 60) : \
+    ((c) < TEMP_CAL_70) ? TEMP_SEGMENT(c, TEMP_CAL_65, TEMP_CAL_70, 65) : \
+    ((c) < TEMP_CAL_75) ? TEMP_SEGMENT(c, TEMP_CAL_70, TEMP_CAL_75, 70) : \
+    ((c) < TEMP_CAL_80) ? TEMP_SEGMENT(c, TEMP_CAL_75, TEMP_CAL_80, 75) : \
+    ((c) < TEMP_CAL_85) ? TEMP_SEGMENT(c, TEMP_CAL_80, TEMP_CAL_85, 80) : \
+    ((c) < TEMP_CAL_90) ? TEMP_SEGMENT(c, TEMP_CAL_85, TEMP_CAL_90, 85) : \
+    ((c) < TEMP_CAL_95) ? TEMP_SEGMENT(c, TEMP_CAL_90, TEMP_CAL_95, 90) : \
+    ((c) < TEMP_CAL_100) ? TEMP_SEGMENT(c, TEMP_CAL_95, TEMP_CAL_100, 95) : \
+    ((c) < TEMP_CAL_105) ? TEMP_SEGMENT(c, TEMP_CAL_100, TEMP_CAL_105, 100) : TEMP_MAX )
+
+#define TEMP_ITEM(n) CODE_TO_TEMP(TEMP_TABLE_FIRST_CODE + (n))
+#define TEMP_ITEMS_4(n) TEMP_ITEM(n), TEMP_ITEM(n + 1), TEMP_ITEM(n + 2), TEMP_ITEM(n + 3)
+#define TEMP_ITEMS_16(n) TEMP_ITEMS_4(n), TEMP_ITEMS_4(n + 4), TEMP_ITEMS_4(n + 8), TEMP_ITEMS_4(n + 12)
+#define TEMP_ITEMS_64(n) TEMP_ITEMS_16(n), TEMP_ITEMS_16(n + 16), TEMP_ITEMS_16(n + 32), TEMP_ITEMS_16(n + 48)
+#define TEMP_ITEMS_256(n) TEMP_ITEMS_64(n), TEMP_ITEMS_64(n + 64), TEMP_ITEMS_64(n + 128), TEMP_ITEMS_64(n + 192)
+#define TEMP_ITEMS_1024(n) TEMP_ITEMS_256(n), TEMP_ITEMS_256(n + 256), TEMP_ITEMS_256(n + 512), TEMP_ITEMS_256(n + 768)
+
+/// Direct indexed conversion table: ADC code - TEMP_TABLE_FIRST_CODE to temperature (0.1C)
+static const int16_t codeToTemp[TEMP_TABLE_DIM] = {
+    TEMP_ITEMS_1024(0), TEMP_ITEMS_1024(1024)
 };
 
-static unsigned char analogToPerc(unsigned char sensor){
-    
-    if(sensor <= 71 ) return 0;
-    if(sensor >= 187 ) return 100;
-    
-    for(int i = 1; i < sizeof(sensToPerc) / sizeof(lookupT); i++){
-        if(sensor < sensToPerc[i].sensor) return sensToPerc[i-1].perc;
-    }
-    
-    return 0;    
+/**
+ * This function converts the filtered ADC code into the temperature.
+ * 
+ * @param sensor: this is the 12 bit ADC code 
+ * @return the temperature in 0.1C units
+ */
+static int16_t analogToTemp(uint16_t sensor){
+    if(sensor <= TEMP_TABLE_FIRST_CODE) return 0;
+    if(sensor >= TEMP_TABLE_FIRST_CODE + TEMP_TABLE_DIM) return TEMP_MAX;
+    return codeToTemp[sensor - TEMP_TABLE_FIRST_CODE];
+}
+
+/**
+ * This function converts the temperature into the percentage.
+ * 
+ * The percentage is 0% up to TEMP_PERC_ZERO and 
+ * increases linearly up to the 100% at TEMP_PERC_FULL. 
+ * 
+ * @param temp: this is the temperature in 0.1C units
+ * @return the temperature percentage
+ */
+static unsigned char tempToPerc(int16_t temp){
+    if(temp <= TEMP_PERC_ZERO) return 0;
+    if(temp >= TEMP_PERC_FULL) return 100;
+    return (unsigned char) (((int32_t) (temp - TEMP_PERC_ZERO) * 100) / (TEMP_PERC_FULL - TEMP_PERC_ZERO));
 }
 
 void XrayLoop(void){
-    static int last_perc = -10;
+    
+    // The window interrupts are disabled during the sensor evaluation
+    ADC0_InterruptsDisable(ADC_STATUS_WINMON);
+    ADC1_InterruptsDisable(ADC_STATUS_WINMON);
     
     // Evaluates the Stator Sensor
-    unsigned char statorSens = ADC0_ConversionResultGet();
+    uint16_t statorSens = adcRingFilter(statorRing);
     setStatorErrorShort(false);
-    if( statorSens < 71 ){
+    if( statorSens < SENSOR_OPEN_LIMIT ){
         // Error cable Open or sensor open
+        statorTemp = 0;
         statorPerc = 0;        
         setStatorErrorLow(true);
         
-    }else if( statorSens > 210 ){
+    }else if( statorSens > SENSOR_SHORT_LIMIT ){
         // Error cable short or sensor short
+        statorTemp = 0;
         statorPerc = 0;
         setStatorErrorShort(true);       
     }
     else {
-        statorPerc = analogToPerc(statorSens);
-        if( statorPerc >= 84 ) setStatorErrorHigh(true);      
+        statorTemp = analogToTemp(statorSens);
+        statorPerc = tempToPerc(statorTemp);
+        if( statorTemp >= TEMP_HIGH_LIMIT ) setStatorErrorHigh(true);      
     }
     SETBYTE_STATOR_PERCENT(statorPerc);
+    SETBYTE_STATOR_TEMP(statorTemp / 10);
             
     // Evaluates the Bulb Sensor
-    unsigned char bulbSens = ADC1_ConversionResultGet();
+    uint16_t bulbSens = adcRingFilter(bulbRing);
     setBulbErrorLow(false);
-    if( bulbSens < 71 ){
+    if( bulbSens < SENSOR_OPEN_LIMIT ){
         // Error cable Open or sensor open
+        bulbTemp = 0;
         bulbPerc = 0;
         setBulbErrorLow(true);
-    }else if( bulbSens > 210 ){
+    }else if( bulbSens > SENSOR_SHORT_LIMIT ){
         // Error cable short or sensor short
+        bulbTemp = 0;
         bulbPerc = 0;
         setBulbErrorShort(true);
     }else {
-        bulbPerc = analogToPerc(bulbSens);      
-        if( bulbPerc >=84 ) setBulbErrorHigh(true);                 
+        bulbTemp = analogToTemp(bulbSens);
+        bulbPerc = tempToPerc(bulbTemp);      
+        if( bulbTemp >= TEMP_HIGH_LIMIT ) setBulbErrorHigh(true);                 
     }    
     SETBYTE_BULB_PERCENT(bulbPerc);
+    SETBYTE_BULB_TEMP(bulbTemp / 10);
+    
+    // Records the temperature history
+    uint8_t faults = 0;
+    if((statorSens < SENSOR_OPEN_LIMIT) || (statorSens > SENSOR_SHORT_LIMIT) || (statorTemp >= TEMP_HIGH_LIMIT)) faults |= HISTORY_FAULT_STATOR;
+    if((bulbSens < SENSOR_OPEN_LIMIT) || (bulbSens > SENSOR_SHORT_LIMIT) || (bulbTemp >= TEMP_HIGH_LIMIT)) faults |= HISTORY_FAULT_BULB;
+    HistoryRecord(statorTemp, bulbTemp, XrayFanDutyCycle, faults);
+    
+    // Rearms the window interrupts of the sensors in the valid range
+    if((statorSens >= SENSOR_OPEN_LIMIT) && (statorSens <= SENSOR_SHORT_LIMIT)){
+        ADC0_InterruptsClear(ADC_STATUS_WINMON);
+        ADC0_InterruptsEnable(ADC_STATUS_WINMON);
+    }
+    if((bulbSens >= SENSOR_OPEN_LIMIT) && (bulbSens <= SENSOR_SHORT_LIMIT)){
+        ADC1_InterruptsClear(ADC_STATUS_WINMON);
+        ADC1_InterruptsEnable(ADC_STATUS_WINMON);
+    }
+}
+
+/**
+ * This function sets the FAN duty cycle.
+ * 
+ * The FAN is driven by the TC0 without any interrupt:
+ * - the TC0 overflow event (EVSYS channel 0) clears the uc_FAN pin (FAN_ON);
+ * - the TC0 compare 1 event (EVSYS channel 1) sets the uc_FAN pin (FAN_OFF).
+ * 
+ * The events act on the pin through the PORT event inputs 0 and 1.
+ * At 0% and 100% the TC0 is stopped and the pin is statically driven. 
+ * 
+ * The new compare value is buffered by the TC0: in case the buffer 
+ * is still busy the function shall be called again to apply the value.
+ * 
+ * @param duty: this is the duty cycle in % (0 to 100)
+ */
+static void XrayFanSetDuty(unsigned char duty){
+    if(duty == XrayFanDutyCycle) return;
+    
+    if((duty == 0) || (duty >= FAN_PWM_PERIOD)){
+        TC0_CompareStop();
+        if(duty) FAN_ON;
+        else FAN_OFF;
+        XrayFanDutyCycle = duty;
+        return;
+    }
+    
+    if(!TC0_Compare8bitMatch1Set(duty)) return;
+    TC0_CompareStart();
+    XrayFanDutyCycle = duty;
+}
+
+/**
+ * This function returns true if the Fan is statically driven.
+ * 
+ * At 0% and 100% the TC0 is stopped: the device can enter the STANDBY mode
+ * (see \ref powerSaveModule).
+ */
+bool XrayFanIsStatic(void){
+    return ((XrayFanDutyCycle == 0) || (XrayFanDutyCycle >= FAN_PWM_PERIOD));
+}
+
+/**
+ * This function sets the Fan controller configuration.
+ * 
+ * @param target: this is the target temperature in C
+ * @param min_duty: this is the min duty cycle (%) with the FAN running
+ * @param max_duty: this is the max duty cycle (%)
+ * @return true if the configuration is valid and accepted
+ */
+bool XrayFanSetControl(uint8_t target, uint8_t min_duty, uint8_t max_duty){
+    if((target < FAN_TARGET_MIN) || (target > FAN_TARGET_MAX)) return false;
+    if((max_duty == 0) || (max_duty > 100)) return false;
+    if(min_duty > max_duty) return false;
     
-    int max_perc;
+    fanTarget = (int16_t) target * 10;
+    fanMinDuty = min_duty;
+    fanMaxDuty = max_duty;
+    return true;
+}
+
+/**
+ * This function returns the temperature rate of rise.
+ * 
+ * The rate is the difference between the average of the newer and 
+ * of the older half of the history, FAN_HISTORY_HALF control periods apart:
+ * every sample noise is averaged over FAN_HISTORY_HALF samples.
+ * 
+ * @return the rate of rise (0.1C/s, Q8), 0 until the history is full
+ */
+static int32_t fanRate(void){
+    int32_t older = 0, newer = 0;
     
-    if(bulbPerc > statorPerc) max_perc = (int) bulbPerc;
-    else max_perc = (int) statorPerc;
+    if(!fanHistoryValid) return 0;
     
-    // Implement an histeresys to prevent the FAN oscillation
-    if( (max_perc > last_perc + 5) || (max_perc < last_perc - 5)){
-        last_perc = max_perc;        
-        
-        if(last_perc < 10) XrayFanDutyCycle = 0;
-        else XrayFanDutyCycle = (last_perc / 10);
+    // fanHistoryIndex is the oldest sample
+    for(int i = 0; i < FAN_HISTORY_HALF; i++){
+        older += fanHistory[(fanHistoryIndex + i) % FAN_HISTORY_DIM];
+        newer += fanHistory[(fanHistoryIndex + FAN_HISTORY_HALF + i) % FAN_HISTORY_DIM];
     }
-   
-   
+    
+    // (newer - older) / FAN_HISTORY_HALF over FAN_HISTORY_HALF * XRAY_FAN_PERIOD ms
+    return ((newer - older) * (1000 / XRAY_FAN_PERIOD)) / (FAN_HISTORY_HALF * FAN_HISTORY_HALF);
 }
 
-void XrayFanManagement(TC_COMPARE_STATUS status, uintptr_t context){
-    static unsigned char pwm_counter = 0;
+/**
+ * This is the Fan control loop, called every 125ms.
+ * 
+ * The function implements a fixed point PI controller 
+ * tracking the target temperature with the hottest valid sensor:
+ * - the proportional and integral terms work on the temperature error;
+ * - the feed-forward term is proportional to the temperature rate of rise
+ *   over the last 4 seconds (see fanRate()), so the FAN reacts at the beginning of a heat-up;
+ * - the integral term is frozen when the output is saturated 
+ *   in the direction of the error (anti-windup);
+ * - the output is limited between the min and max duty cycle.
+ * 
+ * The controller works on the low-pass filtered temperature (FAN_FILTER_SHIFT).
+ * A change larger than FAN_STEP_MAX in a control period is a sensor step 
+ * (the Bulb at the exposure start, or the switch to the other sensor): 
+ * the step is added at once to the filter and to the whole history, 
+ * so the PI term sees the new temperature and the rate of rise doesn't see the step. 
+ * With the default min duty cycle (20%), a heat-up of 0.1C/s alone 
+ * reaches the cut-in: the FAN starts within a few seconds of the target crossing.
+ * 
+ * The FAN starts when the output reaches half the min duty cycle (cut-in) and 
+ * stops when the output is not positive (cut-out): in between the FAN 
+ * keeps its state, so the output doesn't chatter between 0 and the min duty cycle.
+ * 
+ * With both the sensors in error the FAN runs at the max duty cycle.
+ */
+void XrayFanLoop(void){
+    int32_t error, rate, out;
+    int16_t temp = 0;
+    bool valid = false;
+    
+    uint16_t statorSens = adcRingFilter(statorRing);
+    uint16_t bulbSens = adcRingFilter(bulbRing);
     
-    if(pwm_counter >= XrayFanDutyCycle) FAN_OFF;
-    else FAN_ON;
+    // Selects the hottest valid sensor
+    if((statorSens >= SENSOR_OPEN_LIMIT) && (statorSens <= SENSOR_SHORT_LIMIT)){
+        temp = analogToTemp(statorSens);
+        valid = true;
+    }
+    if((bulbSens >= SENSOR_OPEN_LIMIT) && (bulbSens <= SENSOR_SHORT_LIMIT)){
+        int16_t t = analogToTemp(bulbSens);
+        if((!valid) || (t > temp)) temp = t;
+        valid = true;
+    }
     
-    pwm_counter++;
-    if(pwm_counter >= 10) pwm_counter = 0;
-}
\ No newline at end of file
+    if(!valid){
+        fanIntegral = 0;
+        fanHistoryIndex = 0;
+        fanHistoryValid = false;
+        fanRunning = true;
+        XrayFanSetDuty(fanMaxDuty);
+        return;
+    }
+    
+    // Low-pass filter of the sensor noise (starts from the first sample)
+    if((fanHistoryIndex == 0) && (!fanHistoryValid)) fanFiltered = (int32_t) temp << 8;
+    else{
+        // Step rejection: the step is moved into the past
+        int16_t step = temp - fanLastTemp;
+        if((step > FAN_STEP_MAX) || (step < -FAN_STEP_MAX)){
+            fanFiltered += (int32_t) step << 8;
+            for(int i = 0; i < FAN_HISTORY_DIM; i++) fanHistory[i] += (int32_t) step << 8;
+        }
+        fanFiltered += (((int32_t) temp << 8) - fanFiltered) >> FAN_FILTER_SHIFT;
+    }
+    fanLastTemp = temp;
+    temp = (int16_t) (fanFiltered >> 8);
+    
+    fanHistory[fanHistoryIndex] = fanFiltered;
+    if(++fanHistoryIndex >= FAN_HISTORY_DIM){
+        fanHistoryIndex = 0;
+        fanHistoryValid = true;
+    }
+    
+    // Only the heat-up is fed forward
+    rate = fanRate();
+    if(rate < 0) rate = 0;
+    
+    error = temp - fanTarget;
+    // rate (Q8) x FAN_KFF (Q16) >> 8: Q16 duty %
+    out = error * FAN_KP + fanIntegral + rate * (FAN_KFF >> 8);
+    
+    // Anti-windup
+    if( !((out >= FAN_Q16(fanMaxDuty)) && (error > 0)) && !((out <= 0) && (error < 0)) ){
+        fanIntegral += error * FAN_KI;
+        if(fanIntegral > FAN_Q16(fanMaxDuty)) fanIntegral = FAN_Q16(fanMaxDuty);
+        if(fanIntegral < 0) fanIntegral = 0;
+    }
+    
+    out >>= 16;
+    
+    // Cut-in / cut-out hysteresis
+    if(out <= 0) fanRunning = false;
+    else if(out >= fanMinDuty / 2) fanRunning = true;
+    
+    if(!fanRunning) XrayFanSetDuty(0);
+    else if(out < fanMinDuty) XrayFanSetDuty(fanMinDuty);
+    else if(out > fanMaxDuty) XrayFanSetDuty(fanMaxDuty);
+    else XrayFanSetDuty((unsigned char) out);
+}
+
+/**
+ * This function is the Thermal task.
+ *
+ * The task executes the Fan control loop every XRAY_FAN_PERIOD ms
+ * and the XrayLoop() every second, without cumulative drift.
+ *
+ * @param param: not used
+ */
+void XrayTask(void* param){
+    TickType_t wake = xTaskGetTickCount();
+    uint8_t count = 0;
+
+    while(true){
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(XRAY_FAN_PERIOD));
+        
+        PROFILER_START(PROFILER_PROBE_FAN_LOOP);
+        XrayFanLoop();
+        PROFILER_STOP(PROFILER_PROBE_FAN_LOOP);
+
+        if(++count < (1000 / XRAY_FAN_PERIOD)) continue;
+        count = 0;
+        
+        PROFILER_START(PROFILER_PROBE_XRAY_LOOP);
+        XrayLoop();
+        PROFILER_STOP(PROFILER_PROBE_XRAY_LOOP);
+    }
+}
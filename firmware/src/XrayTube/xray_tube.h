@@ -38,6 +38,54 @@
  * 
  * ## Module Function Description
  *  
+ * ### Temperature sampling
+ * 
+ * The ADC0 (Stator sensor) and ADC1 (Bulb sensor) run in free running mode
+ * with the hardware averaging of 16 conversions (AVGCTRL) at 12 bit resolution.
+ * 
+ * The DMAC channels 0 and 1, triggered by the ADC RESRDY, 
+ * move the results into two ring buffers without CPU intervention.
+ * The temperature evaluation reads the mean value of the ring buffers.
+ * 
+ * ### Temperature conversion
+ * 
+ * The sensor code is converted into 0.1C units with a direct indexed table.
+ * The table is generated at build time with the linear interpolation 
+ * of the sensor calibration points (one every 5C).
+ * 
+ * The temperatures (C) are reported in the TEMPERATURE_STATUS_REGISTER,
+ * and the percentages (0% at 20C, 1.2% per C) in the SYSTEM_STATUS_REGISTER.
+ * The High temperature error is set at 90C.
+ * 
+ * ### Sensor fault detection
+ * 
+ * The ADCs work in window mode (WINMODE 4) with the sensor open 
+ * and short limits: an out of window result raises the ADCx_OTHER interrupt
+ * that sets the sensor error at once, without waiting the XrayLoop().
+ * 
+ * ### Fan drive
+ * 
+ * The uc_FAN pin (PA27) has no TC/TCC waveform output: the PWM (1% steps) 
+ * is generated by the TC0 events routed to the PORT event inputs by the EVSYS,
+ * so no interrupt is required. At 0% and 100% the TC0 is stopped.
+ * 
+ * ### Fan control
+ * 
+ * The duty cycle is set every 125ms by a fixed point PI controller tracking 
+ * the target temperature (PROTO_PARAM_FAN_CONTROL) with the hottest valid sensor.
+ * A feed-forward term proportional to the temperature rate of rise (averaged 
+ * over the last 4 seconds) anticipates the heat-up of the exposure bursts:
+ * the sensor steps (the Bulb at the exposure start) are not a rate of rise. 
+ * The output is limited to the min/max duty cycle of the PROTO_PARAM_FAN_CONTROL,
+ * with a cut-in/cut-out hysteresis between 0 and the min duty cycle.
+ * 
+ * ### Thermal task
+ * 
+ * The XrayTask() executes the XrayFanLoop() every XRAY_FAN_PERIOD ms
+ * and the XrayLoop() every second, at a lower priority than 
+ * the Protocol and Motion tasks.
+ * The sensor errors and the history samples are posted to the Protocol task.
+ * 
  * 
  *  @{
  * 
@@ -53,10 +101,32 @@
         
         ext void XrayLoop(void);
         
+        /// This is the Fan control loop (125ms)
+        ext void XrayFanLoop(void);
+        
+        /// This is the Fan controller configuration
+        ext bool XrayFanSetControl(uint8_t target, uint8_t min_duty, uint8_t max_duty);
+        
+        /// This function returns true if the Fan is statically driven (TC0 stopped)
+        ext bool XrayFanIsStatic(void);
+        
+        /// This is the Thermal task
+        ext void XrayTask(void* param);
         
         
     /** @}*/ // xrayApiModule
         
+    /**
+    * \defgroup xrayMacroModule Module's Macros
+    *  @{
+    */
+        
+        #define XRAY_TASK_PRIORITY  (tskIDLE_PRIORITY + 2)  //!< Thermal task priority
+        #define XRAY_TASK_STACK     256                     //!< Thermal task stack size (words)
+        #define XRAY_FAN_PERIOD     125                     //!< Fan control loop period (ms)
+        
+    /** @}*/ // xrayMacroModule
+        
 
 
          
@@ -50,6 +50,7 @@
 #include <stdbool.h>
 #include "peripheral/nvmctrl/plib_nvmctrl.h"
 #include "peripheral/evsys/plib_evsys.h"
+#include "peripheral/dmac/plib_dmac.h"
 #include "peripheral/adc/plib_adc0.h"
 #include "peripheral/port/plib_port.h"
 #include "peripheral/clock/plib_clock.h"
@@ -60,6 +61,10 @@
 #include "peripheral/tc/plib_tc1.h"
 #include "peripheral/rtc/plib_rtc.h"
 #include "peripheral/tc/plib_tc0.h"
+#include "peripheral/tc/plib_tc2.h"
+#include "peripheral/sercom/usart/plib_sercom5_usart.h"
+#include "FreeRTOS.h"
+#include "task.h"
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
@@ -119,8 +124,43 @@ extern "C" {
 
 void SYS_Initialize( void *data );
 
-/* Nullify SYS_Tasks() if only PLIBs are used. */
-#define     SYS_Tasks()
+// *****************************************************************************
+/* System Tasks Function
+
+Function:
+    void SYS_Tasks ( void );
+
+Summary:
+    Function that starts the RTOS scheduler.
+
+Description:
+    The application threads shall be created before calling this function:
+    the function starts the FreeRTOS scheduler and never returns.
+
+Precondition:
+    The SYS_Initialize() function should have been called before calling
+    this function.
+
+Parameters:
+    None.
+
+Returns:
+    None.
+
+Example:
+    <code>
+    SYS_Initialize ( NULL );
+
+    // Application threads creation ..
+
+    SYS_Tasks ( );
+    </code>
+
+Remarks:
+    None.
+*/
+
+void SYS_Tasks ( void );
 
 // *****************************************************************************
 // *****************************************************************************
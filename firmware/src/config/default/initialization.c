@@ -45,6 +45,7 @@
 // *****************************************************************************
 #include "definitions.h"
 #include "device.h"
+#include "Boot/boot.h"
 
 
 
@@ -120,22 +121,33 @@
 
 void SYS_Initialize ( void* data )
 {
+    // Boot stage time stamps (see Boot module)
+    BootInit();
 
     NVMCTRL_Initialize( );
+    BootStage(BOOT_STAGE_NVMCTRL);
 
   
     PORT_Initialize();
+    BootStage(BOOT_STAGE_PORT);
 
     CLOCK_Initialize();
+    BootStage(BOOT_STAGE_CLOCK);
 
 
 
 
     EVSYS_Initialize();
 
+    DMAC_Initialize();
+    BootStage(BOOT_STAGE_DMAC);
+
+
     ADC0_Initialize();
     ADC1_Initialize();
+    BootStage(BOOT_STAGE_ADC);
     CAN0_Initialize();
+    BootStage(BOOT_STAGE_CAN);
 
     TC1_CompareInitialize();
 
@@ -143,11 +155,17 @@ void SYS_Initialize ( void* data )
 
     TC0_CompareInitialize();
 
+    TC2_TimerInitialize();
+
+    SERCOM5_USART_Initialize();
+    BootStage(BOOT_STAGE_TIMERS);
+
 
 
 
 
     NVIC_Initialize();
+    BootStage(BOOT_STAGE_NVIC);
 
 }
 
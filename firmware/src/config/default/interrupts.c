@@ -115,7 +115,6 @@ extern void NVMCTRL_0_Handler          ( void ) __attribute__((weak, alias("Dumm
 extern void NVMCTRL_1_Handler          ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void DMAC_0_Handler             ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void DMAC_1_Handler             ( void ) __attribute__((weak, alias("Dummy_Handler")));
-extern void DMAC_2_Handler             ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void DMAC_3_Handler             ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void DMAC_OTHER_Handler         ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void EVSYS_0_Handler            ( void ) __attribute__((weak, alias("Dummy_Handler")));
@@ -176,6 +175,7 @@ extern void TCC3_MC1_Handler           ( void ) __attribute__((weak, alias("Dumm
 extern void TCC4_OTHER_Handler         ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void TCC4_MC0_Handler           ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void TCC4_MC1_Handler           ( void ) __attribute__((weak, alias("Dummy_Handler")));
+extern void TC0_Handler                ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void TC2_Handler                ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void TC3_Handler                ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void TC4_Handler                ( void ) __attribute__((weak, alias("Dummy_Handler")));
@@ -183,9 +183,7 @@ extern void TC5_Handler                ( void ) __attribute__((weak, alias("Dumm
 extern void PDEC_OTHER_Handler         ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void PDEC_MC0_Handler           ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void PDEC_MC1_Handler           ( void ) __attribute__((weak, alias("Dummy_Handler")));
-extern void ADC0_OTHER_Handler         ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void ADC0_RESRDY_Handler        ( void ) __attribute__((weak, alias("Dummy_Handler")));
-extern void ADC1_OTHER_Handler         ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void ADC1_RESRDY_Handler        ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void AC_Handler                 ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void DAC_OTHER_Handler          ( void ) __attribute__((weak, alias("Dummy_Handler")));
@@ -257,7 +255,7 @@ const H3DeviceVectors exception_table=
     .pfnNVMCTRL_1_Handler          = NVMCTRL_1_Handler,
     .pfnDMAC_0_Handler             = DMAC_0_Handler,
     .pfnDMAC_1_Handler             = DMAC_1_Handler,
-    .pfnDMAC_2_Handler             = DMAC_2_Handler,
+    .pfnDMAC_2_Handler             = DMAC_2_InterruptHandler,
     .pfnDMAC_3_Handler             = DMAC_3_Handler,
     .pfnDMAC_OTHER_Handler         = DMAC_OTHER_Handler,
     .pfnEVSYS_0_Handler            = EVSYS_0_Handler,
@@ -291,7 +289,7 @@ const H3DeviceVectors exception_table=
     .pfnSERCOM5_1_Handler          = SERCOM5_1_Handler,
     .pfnSERCOM5_2_Handler          = SERCOM5_2_Handler,
     .pfnSERCOM5_OTHER_Handler      = SERCOM5_OTHER_Handler,
-    .pfnCAN0_Handler               = CAN0_InterruptHandler,
+    .pfnCAN0_Handler               = ApplicationProtocolCanInterruptHandler,
     .pfnCAN1_Handler               = CAN1_Handler,
     .pfnUSB_OTHER_Handler          = USB_OTHER_Handler,
     .pfnUSB_SOF_HSOF_Handler       = USB_SOF_HSOF_Handler,
@@ -319,7 +317,7 @@ const H3DeviceVectors exception_table=
     .pfnTCC4_OTHER_Handler         = TCC4_OTHER_Handler,
     .pfnTCC4_MC0_Handler           = TCC4_MC0_Handler,
     .pfnTCC4_MC1_Handler           = TCC4_MC1_Handler,
-    .pfnTC0_Handler                = TC0_CompareInterruptHandler,
+    .pfnTC0_Handler                = TC0_Handler,
     .pfnTC1_Handler                = TC1_CompareInterruptHandler,
     .pfnTC2_Handler                = TC2_Handler,
     .pfnTC3_Handler                = TC3_Handler,
@@ -328,9 +326,9 @@ const H3DeviceVectors exception_table=
     .pfnPDEC_OTHER_Handler         = PDEC_OTHER_Handler,
     .pfnPDEC_MC0_Handler           = PDEC_MC0_Handler,
     .pfnPDEC_MC1_Handler           = PDEC_MC1_Handler,
-    .pfnADC0_OTHER_Handler         = ADC0_OTHER_Handler,
+    .pfnADC0_OTHER_Handler         = ADC0_OTHER_InterruptHandler,
     .pfnADC0_RESRDY_Handler        = ADC0_RESRDY_Handler,
-    .pfnADC1_OTHER_Handler         = ADC1_OTHER_Handler,
+    .pfnADC1_OTHER_Handler         = ADC1_OTHER_InterruptHandler,
     .pfnADC1_RESRDY_Handler        = ADC1_RESRDY_Handler,
     .pfnAC_Handler                 = AC_Handler,
     .pfnDAC_OTHER_Handler          = DAC_OTHER_Handler,
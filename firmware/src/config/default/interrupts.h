@@ -61,8 +61,11 @@ void NonMaskableInt_Handler (void);
 void HardFault_Handler (void);
 void RTC_InterruptHandler (void);
 void CAN0_InterruptHandler (void);
-void TC0_CompareInterruptHandler (void);
+void ApplicationProtocolCanInterruptHandler (void);
 void TC1_CompareInterruptHandler (void);
+void ADC0_OTHER_InterruptHandler (void);
+void ADC1_OTHER_InterruptHandler (void);
+void DMAC_2_InterruptHandler (void);
 
 
 
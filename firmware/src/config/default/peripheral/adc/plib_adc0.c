@@ -62,6 +62,8 @@
 // *****************************************************************************
 // *****************************************************************************
 
+ADC_CALLBACK_OBJ ADC0_CallbackObject;
+
 #define ADC0_BIASCOMP_POS  (2)
 #define ADC0_BIASCOMP_Msk   (0x7 << ADC0_BIASCOMP_POS)
 
@@ -109,12 +111,23 @@ void ADC0_Initialize( void )
     ADC0_REGS->ADC_INPUTCTRL = (uint16_t) ADC_POSINPUT_AIN2 | (uint16_t) ADC_NEGINPUT_GND ;
 
     /* Resolution & Operation Mode */
-    ADC0_REGS->ADC_CTRLB = ADC_CTRLB_RESSEL_8BIT | ADC_CTRLB_WINMODE(0) | ADC_CTRLB_FREERUN_Msk;
+    ADC0_REGS->ADC_CTRLB = ADC_CTRLB_RESSEL_16BIT | ADC_CTRLB_WINMODE(4) | ADC_CTRLB_FREERUN_Msk;
+
+    /* Result averaging */
+    ADC0_REGS->ADC_AVGCTRL = ADC_AVGCTRL_SAMPLENUM_16 | ADC_AVGCTRL_ADJRES(4);
+
 
+    /* Upper threshold for window mode  */
+    ADC0_REGS->ADC_WINUT = 3360;
+    /* Lower threshold for window mode  */
+    ADC0_REGS->ADC_WINLT = 1136;
 
     /* Clear all interrupt flags */
     ADC0_REGS->ADC_INTFLAG = ADC_INTFLAG_Msk;
 
+    /* Enable interrupts */
+    ADC0_REGS->ADC_INTENSET = ADC_INTENSET_WINMON_Msk;
+
     while(ADC0_REGS->ADC_SYNCBUSY)
     {
         /* Wait for Synchronization */
@@ -230,3 +243,22 @@ bool ADC0_ConversionStatusGet( void )
     return status;
 }
 
+/* Register callback function */
+void ADC0_CallbackRegister( ADC_CALLBACK callback, uintptr_t context )
+{
+    ADC0_CallbackObject.callback = callback;
+
+    ADC0_CallbackObject.context = context;
+}
+
+void ADC0_OTHER_InterruptHandler( void )
+{
+    ADC_STATUS status;
+    status = ADC0_REGS->ADC_INTFLAG & (ADC_INTFLAG_WINMON_Msk | ADC_INTFLAG_OVERRUN_Msk);
+    /* Clear interrupt flag */
+    ADC0_REGS->ADC_INTFLAG = status;
+    if (ADC0_CallbackObject.callback != NULL)
+    {
+        ADC0_CallbackObject.callback(status, ADC0_CallbackObject.context);
+    }
+}
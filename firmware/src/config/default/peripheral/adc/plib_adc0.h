@@ -115,6 +115,8 @@ void ADC0_InterruptsDisable(ADC_STATUS interruptMask);
 
 bool ADC0_ConversionStatusGet( void );
 
+void ADC0_CallbackRegister( ADC_CALLBACK callback, uintptr_t context );
+
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
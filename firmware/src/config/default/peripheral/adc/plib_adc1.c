@@ -62,6 +62,8 @@
 // *****************************************************************************
 // *****************************************************************************
 
+ADC_CALLBACK_OBJ ADC1_CallbackObject;
+
 #define ADC1_BIASCOMP_POS  (16)
 #define ADC1_BIASCOMP_Msk   (0x7 << ADC1_BIASCOMP_POS)
 
@@ -108,12 +110,23 @@ void ADC1_Initialize( void )
     ADC1_REGS->ADC_INPUTCTRL = (uint16_t) ADC_POSINPUT_AIN1 | (uint16_t) ADC_NEGINPUT_GND ;
 
     /* Resolution & Operation Mode */
-    ADC1_REGS->ADC_CTRLB = ADC_CTRLB_RESSEL_8BIT | ADC_CTRLB_WINMODE(0) | ADC_CTRLB_FREERUN_Msk;
+    ADC1_REGS->ADC_CTRLB = ADC_CTRLB_RESSEL_16BIT | ADC_CTRLB_WINMODE(4) | ADC_CTRLB_FREERUN_Msk;
+
+    /* Result averaging */
+    ADC1_REGS->ADC_AVGCTRL = ADC_AVGCTRL_SAMPLENUM_16 | ADC_AVGCTRL_ADJRES(4);
+
 
+    /* Upper threshold for window mode  */
+    ADC1_REGS->ADC_WINUT = 3360;
+    /* Lower threshold for window mode  */
+    ADC1_REGS->ADC_WINLT = 1136;
 
     /* Clear all interrupt flags */
     ADC1_REGS->ADC_INTFLAG = ADC_INTFLAG_Msk;
 
+    /* Enable interrupts */
+    ADC1_REGS->ADC_INTENSET = ADC_INTENSET_WINMON_Msk;
+
     while(ADC1_REGS->ADC_SYNCBUSY)
     {
         /* Wait for Synchronization */
@@ -229,3 +242,22 @@ bool ADC1_ConversionStatusGet( void )
     return status;
 }
 
+/* Register callback function */
+void ADC1_CallbackRegister( ADC_CALLBACK callback, uintptr_t context )
+{
+    ADC1_CallbackObject.callback = callback;
+
+    ADC1_CallbackObject.context = context;
+}
+
+void ADC1_OTHER_InterruptHandler( void )
+{
+    ADC_STATUS status;
+    status = ADC1_REGS->ADC_INTFLAG & (ADC_INTFLAG_WINMON_Msk | ADC_INTFLAG_OVERRUN_Msk);
+    /* Clear interrupt flag */
+    ADC1_REGS->ADC_INTFLAG = status;
+    if (ADC1_CallbackObject.callback != NULL)
+    {
+        ADC1_CallbackObject.callback(status, ADC1_CallbackObject.context);
+    }
+}
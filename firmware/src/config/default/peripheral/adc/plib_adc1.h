@@ -115,6 +115,8 @@ void ADC1_InterruptsDisable(ADC_STATUS interruptMask);
 
 bool ADC1_ConversionStatusGet( void );
 
+void ADC1_CallbackRegister( ADC_CALLBACK callback, uintptr_t context );
+
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
@@ -45,6 +45,14 @@
 
 void EVSYS_Initialize( void )
 {
+    /*Event Channel Configuration*/
+    EVSYS_REGS->CHANNEL[0].EVSYS_CHANNEL = EVSYS_CHANNEL_EVGEN(73) | EVSYS_CHANNEL_PATH(2) | EVSYS_CHANNEL_EDGSEL(0) \
+                                     | EVSYS_CHANNEL_RUNSTDBY(0) | EVSYS_CHANNEL_ONDEMAND(0) ;
+    EVSYS_REGS->CHANNEL[1].EVSYS_CHANNEL = EVSYS_CHANNEL_EVGEN(75) | EVSYS_CHANNEL_PATH(2) | EVSYS_CHANNEL_EDGSEL(0) \
+                                     | EVSYS_CHANNEL_RUNSTDBY(0) | EVSYS_CHANNEL_ONDEMAND(0) ;
+
     /*Event Channel User Configuration*/
+    EVSYS_REGS->EVSYS_USER[1] = EVSYS_USER_CHANNEL(0x1);
+    EVSYS_REGS->EVSYS_USER[2] = EVSYS_USER_CHANNEL(0x2);
 
 }
@@ -63,10 +63,14 @@ void NVIC_Initialize( void )
     NVIC_EnableIRQ(RTC_IRQn);
     NVIC_SetPriority(CAN0_IRQn, 7);
     NVIC_EnableIRQ(CAN0_IRQn);
-    NVIC_SetPriority(TC0_IRQn, 7);
-    NVIC_EnableIRQ(TC0_IRQn);
     NVIC_SetPriority(TC1_IRQn, 7);
     NVIC_EnableIRQ(TC1_IRQn);
+    NVIC_SetPriority(ADC0_OTHER_IRQn, 7);
+    NVIC_EnableIRQ(ADC0_OTHER_IRQn);
+    NVIC_SetPriority(ADC1_OTHER_IRQn, 7);
+    NVIC_EnableIRQ(ADC1_OTHER_IRQn);
+    NVIC_SetPriority(DMAC_2_IRQn, 7);
+    NVIC_EnableIRQ(DMAC_2_IRQn);
 
 
 
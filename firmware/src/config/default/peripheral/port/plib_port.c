@@ -87,8 +87,11 @@ void PORT_Initialize(void)
    PORT_REGS->GROUP[0].PORT_PMUX[3] = 0x4;
    PORT_REGS->GROUP[0].PORT_PMUX[11] = 0x88;
 
+   PORT_REGS->GROUP[0].PORT_EVCTRL = 0xbbdb;
+
    /************************** GROUP 1 Initialization *************************/
    PORT_REGS->GROUP[1].PORT_DIR = 0x80c30c00;
+   PORT_REGS->GROUP[1].PORT_PINCFG[2] = 0x1;
    PORT_REGS->GROUP[1].PORT_PINCFG[4] = 0x40;
    PORT_REGS->GROUP[1].PORT_PINCFG[7] = 0x1;
    PORT_REGS->GROUP[1].PORT_PINCFG[8] = 0x1;
@@ -96,6 +99,7 @@ void PORT_Initialize(void)
    PORT_REGS->GROUP[1].PORT_PINCFG[23] = 0x40;
    PORT_REGS->GROUP[1].PORT_PINCFG[31] = 0x40;
 
+   PORT_REGS->GROUP[1].PORT_PMUX[1] = 0x3;
    PORT_REGS->GROUP[1].PORT_PMUX[3] = 0x10;
    PORT_REGS->GROUP[1].PORT_PMUX[4] = 0x11;
 
@@ -59,7 +59,7 @@ void RTC_Initialize(void)
 
 
 
-    RTC_REGS->MODE0.RTC_CTRLA = (uint16_t)(RTC_MODE0_CTRLA_MODE(0UL) | RTC_MODE0_CTRLA_PRESCALER(0x1UL) | RTC_MODE0_CTRLA_COUNTSYNC_Msk );
+    RTC_REGS->MODE0.RTC_CTRLA = (uint16_t)(RTC_MODE0_CTRLA_MODE(0UL) | RTC_MODE0_CTRLA_PRESCALER(0x6UL) | RTC_MODE0_CTRLA_COUNTSYNC_Msk );
 
     RTC_REGS->MODE0.RTC_COMP[0] = 0x0U;
 
@@ -75,7 +75,7 @@ void RTC_Initialize(void)
         /* Wait for Synchronization after writing Compare Value */
     }
 
-    RTC_REGS->MODE0.RTC_INTENSET = 0x83U;
+    RTC_REGS->MODE0.RTC_INTENSET = 0x0U;
 
 }
 
@@ -62,7 +62,6 @@
 // *****************************************************************************
 // *****************************************************************************
 
-static TC_COMPARE_CALLBACK_OBJ TC0_CallbackObject;
 
 // *****************************************************************************
 // *****************************************************************************
@@ -85,17 +84,18 @@ void TC0_CompareInitialize( void )
     TC0_REGS->COUNT8.TC_CTRLA = TC_CTRLA_MODE_COUNT8 | TC_CTRLA_PRESCALER_DIV256 | TC_CTRLA_PRESCSYNC_PRESC ;
 
     /* Configure waveform generation mode */
-    TC0_REGS->COUNT8.TC_WAVE = (uint8_t)TC_WAVE_WAVEGEN_MFRQ;
+    TC0_REGS->COUNT8.TC_WAVE = (uint8_t)TC_WAVE_WAVEGEN_NPWM;
 
+    /* Configure timer period */
+    TC0_REGS->COUNT8.TC_PER = 99U;
 
-    TC0_REGS->COUNT8.TC_CC[0] = 8U;
+    /* Configure timer one compare value */
+    TC0_REGS->COUNT8.TC_CC[1] = 0U;
 
     /* Clear all interrupt flags */
     TC0_REGS->COUNT8.TC_INTFLAG = (uint8_t)TC_INTFLAG_Msk;
 
-    /* Enable period Interrupt */
-    TC0_CallbackObject.callback = NULL;
-    TC0_REGS->COUNT8.TC_INTENSET = (uint8_t)(TC_INTENSET_OVF_Msk);
+    TC0_REGS->COUNT8.TC_EVCTRL = (uint16_t)(TC_EVCTRL_OVFEO_Msk | TC_EVCTRL_MCEO1_Msk);
 
     while((TC0_REGS->COUNT8.TC_SYNCBUSY) != 0U)
     {
@@ -213,32 +213,3 @@ bool TC0_Compare8bitMatch1Set( uint8_t compareValue )
     }
     return status;
 }
-
-
-
-
-
-/* Register callback function */
-void TC0_CompareCallbackRegister( TC_COMPARE_CALLBACK callback, uintptr_t context )
-{
-    TC0_CallbackObject.callback = callback;
-
-    TC0_CallbackObject.context = context;
-}
-
-/* Compare match interrupt handler */
-void TC0_CompareInterruptHandler( void )
-{
-    if (TC0_REGS->COUNT8.TC_INTENSET != 0U)
-    {
-        TC_COMPARE_STATUS status;
-        status = TC0_REGS->COUNT8.TC_INTFLAG;
-        /* clear period interrupt */
-        TC0_REGS->COUNT8.TC_INTFLAG = (uint8_t)TC_INTFLAG_Msk;
-        if((status != TC_COMPARE_STATUS_NONE) && TC0_CallbackObject.callback != NULL)
-        {
-            TC0_CallbackObject.callback(status, TC0_CallbackObject.context);
-        }
-    }
-}
-
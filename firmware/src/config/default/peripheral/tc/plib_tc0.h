@@ -107,9 +107,6 @@ bool TC0_Compare8bitMatch0Set( uint8_t compareValue );
 bool TC0_Compare8bitMatch1Set( uint8_t compareValue );
 
 
-void TC0_CompareCallbackRegister( TC_COMPARE_CALLBACK callback, uintptr_t context );
-
-
 void TC0_CompareCommandSet(TC_COMMAND command);
 
 
@@ -46,6 +46,7 @@
 
 #include "definitions.h"
 #include <device.h>
+#include "../../../Lib/MET_Bootloader_table.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -72,6 +73,8 @@
 #define HEADER_SIZE_OFFSET       3
 
 #define CRC_SIZE                 4
+#define VERIFY_FLAGS_OFFSET      (HEADER_SIZE + CRC_SIZE)
+#define VERIFY_READBACK          0x01
 #define HEADER_SIZE              4
 #define OFFSET_SIZE              4
 #define SIZE_SIZE                4
@@ -82,15 +85,53 @@
 
 #define WORDS(x)                 ((int)((x) / sizeof(uint32_t)))
 
+/* The flash is memory mapped: the host build (tools/bl_emulator) maps a flash array */
+#ifndef FLASH_PTR
+#define FLASH_PTR(addr)          ((uint8_t *)(addr))
+#endif
+
+/* RX FIFO0 fill level: the host build (tools/bl_emulator) maps the mock FIFO */
+#ifndef RX_FIFO0_LEVEL
+#define RX_FIFO0_LEVEL()         ((CAN0_REGS->CAN_RXF0S & CAN_RXF0S_F0FL_Msk) >> CAN_RXF0S_F0FL_Pos)
+#endif
+
 #define OFFSET_ALIGN_MASK        (~ERASE_BLOCK_SIZE + 1)
 #define SIZE_ALIGN_MASK          (~PAGE_SIZE + 1)
 
+#define FORMAT_OFFSET            HEADER_SIZE
+#define FORMAT_RAW               0
+#define FORMAT_LZ4               1
+#define FORMAT_DELTA             2
+#define FORMAT_DELTA_SIZE        12
+#define DELTA_RELEASE_OFFSET     2
+#define DELTA_CRC_OFFSET         3
+
+#define WINDOW_MAX               8
+#define WINDOW_SIZE_OFFSET       HEADER_SIZE
+
+#define RESUME_SIZE              (OFFSET_SIZE + SIZE_SIZE)
+#define RESUME_RESP_SIZE         5
+
+#define JOURNAL_START            (0x7C000UL)
+#define JOURNAL_SIZE             (2 * ERASE_BLOCK_SIZE)
+#define JOURNAL_END              (JOURNAL_START + JOURNAL_SIZE)
+#define JOURNAL_ENTRY_SIZE       16
+#define JOURNAL_MAGIC            0x4C4E524AUL
+
+#define FLASH_BUFFERS            2
+#define FLASH_ERASE_AHEAD        ERASE_BLOCK_SIZE
+#define FLASH_ERROR_MASK         (NVMCTRL_INTFLAG_ADDRE_Msk | NVMCTRL_INTFLAG_PROGE_Msk | \
+                                  NVMCTRL_INTFLAG_LOCKE_Msk | NVMCTRL_INTFLAG_NVME_Msk)
+
 enum
 {
     BL_CMD_UNLOCK       = 0xa0,
     BL_CMD_DATA         = 0xa1,
     BL_CMD_VERIFY       = 0xa2,
     BL_CMD_RESET        = 0xa3,
+    BL_CMD_WINDOW       = 0xa4,
+    BL_CMD_FORMAT       = 0xa5,
+    BL_CMD_RESUME       = 0xa6,
 };
 
 enum
@@ -100,7 +141,40 @@ enum
     BL_RESP_INVALID     = 0x52,
     BL_RESP_CRC_OK      = 0x53,
     BL_RESP_CRC_FAIL    = 0x54,
-    BL_RESP_SEQ_ERROR   = 0x55
+    BL_RESP_SEQ_ERROR   = 0x55,
+    BL_RESP_ACK         = 0x56,
+    BL_RESP_NACK        = 0x57,
+    BL_RESP_RESUME      = 0x58
+};
+
+/* Delta stream records */
+enum
+{
+    DELTA_BLOCK_SKIP    = 0x01,
+    DELTA_BLOCK_PATCH   = 0x02,
+    DELTA_COPY          = 0x03,
+    DELTA_DATA          = 0x04,
+};
+
+/* Delta stream decoder states */
+enum
+{
+    DELTA_RECORD = 0,
+    DELTA_SKIP_COUNT,
+    DELTA_LENGTH_LOW,
+    DELTA_LENGTH_HIGH,
+    DELTA_BYTES,
+};
+
+/* LZ4 stream decoder states */
+enum
+{
+    LZ4_TOKEN = 0,
+    LZ4_LITERAL_LENGTH,
+    LZ4_LITERALS,
+    LZ4_OFFSET_LOW,
+    LZ4_OFFSET_HIGH,
+    LZ4_MATCH_LENGTH,
 };
 
 // *****************************************************************************
@@ -109,7 +183,17 @@ enum
 // *****************************************************************************
 // *****************************************************************************
 
-static uint8_t  flash_data[PAGE_SIZE];
+/* Double buffered page writer: a buffer is filled by BL_CMD_DATA while
+   the other one is waiting for the NVMCTRL */
+static uint8_t  flash_data[FLASH_BUFFERS][PAGE_SIZE];
+static uint32_t flash_page_addr[FLASH_BUFFERS];
+static bool     flash_page_ready[FLASH_BUFFERS];
+static uint8_t  flash_fill;
+static uint8_t  flash_program;
+static uint32_t flash_erase_addr;
+static bool     flash_error;
+static uint32_t flash_erase_end;
+
 static uint32_t flash_addr;
 static uint32_t flash_size;
 static uint32_t flash_ptr;
@@ -121,6 +205,38 @@ static uint8_t CACHE_ALIGN MessageRAM[_MESSAGE_RAM_CONFIG_SIZE];
 static uint8_t rx_message[HEADER_SIZE + MAX_DATA_SIZE];
 static uint8_t data_seq;
 
+/* Image format of BL_CMD_DATA (FORMAT_xx) and LZ4 decoder status */
+static uint8_t  image_format;
+static uint8_t  lz4_state;
+static uint8_t  lz4_token;
+static uint32_t lz4_length;
+static uint32_t lz4_offset;
+
+/* Delta decoder status: the block being patched is copied in RAM before its erase */
+static uint8_t  delta_block[ERASE_BLOCK_SIZE];
+static uint32_t delta_block_addr;
+static bool     delta_patch;
+static uint8_t  delta_state;
+static uint8_t  delta_record;
+static uint32_t delta_length;
+
+/* Progress journal in the flash rows reserved above the application (JOURNAL_START,
+   the application ROM ends at 0x78000):
+   a header quad word with the unlocked range and, for every committed page of a raw
+   image, a quad word with the page address and the CRC of the image up to the page */
+static uint32_t journal_next;
+static uint32_t journal_entry[4];
+static bool     journal_pending;
+
+/* Sliding window mode (window_size > 0): frames received beyond a gap
+   are kept in the slot (sequence % WINDOW_MAX) until the gap is filled */
+static uint8_t window_size;
+static uint8_t window_acked;
+static bool    window_nack;
+static uint8_t window_data[WINDOW_MAX][MAX_DATA_SIZE];
+static uint8_t window_length[WINDOW_MAX];
+static bool    window_valid[WINDOW_MAX];
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Bootloader Local Functions
@@ -143,26 +259,681 @@ static uint32_t crc_generate(void)
     return crc;
 }
 
-/* Function to program received application firmware data into internal flash */
+/* Functions to compute the CRC of the programmed data while the pages are committed.
+   The DMAC CRC engine is kept in I/O mode for the whole session, so the checksum
+   is never re-seeded between the pages. The DMAC returns the complemented CRC-32
+   (IEEE 802.3): the result is complemented back to the DSU value expected by the HOST.
+   A partial result is a valid seed to continue the same CRC (see journal_resume()) */
+static void crc_stream_start(uint32_t seed)
+{
+    DMAC_CRC_SETUP crc_setup = {DMAC_CRC_TYPE_32, DMAC_CRC_MODE_DEFAULT, seed};
+
+    /* No data: it only seeds the engine and selects the I/O interface (32 bit beats) */
+    DMAC_CRCCalculate(NULL, 0, crc_setup);
+}
+
+static void crc_stream_update(const uint32_t *buffer, uint32_t words)
+{
+    for (uint32_t i = 0; i < words; i++)
+    {
+        DMAC_REGS->DMAC_CRCDATAIN = buffer[i];
+
+        /* Wait until CRC Calculation is completed for the current data in CRCDATAIN */
+        while (!(DMAC_REGS->DMAC_CRCSTATUS & DMAC_CRCSTATUS_CRCBUSY_Msk));
+
+        DMAC_REGS->DMAC_CRCSTATUS = DMAC_CRCSTATUS_CRCBUSY_Msk;
+    }
+}
+
+static uint32_t crc_stream_result(void)
+{
+    return ~DMAC_CRCRead();
+}
+
+/* Function to prepare the journal entry of the page being written:
+   it is written by flash_task() when the page write is completed.
+   The LZ4 and delta streams can't be resumed at a page boundary, so
+   only the pages of a raw image are recorded */
+static void journal_record(uint32_t addr)
+{
+    uint32_t crc = crc_stream_result();
+
+    if ((FORMAT_RAW != image_format) || (journal_next < JOURNAL_START) || (journal_next >= JOURNAL_END))
+    {
+        return;
+    }
+    journal_entry[0] = addr;
+    journal_entry[1] = crc;
+    journal_entry[2] = ~addr;
+    journal_entry[3] = ~crc;
+    journal_pending = true;
+}
+
+/* Function to advance the flash pipeline without waiting for the NVMCTRL.
+   At every call, if the NVMCTRL is ready, it starts one operation:
+   - the journal entry of the last page written;
+   - the write of the oldest completed page buffer, if its block is erased;
+   - otherwise the erase of the next block, up to FLASH_ERASE_AHEAD bytes
+     beyond the block being received and below flash_erase_end.
+   The page buffer is free as soon as the write starts, because the data
+   are copied into the NVMCTRL page buffer */
+static void flash_task(void)
+{
+    if (NVMCTRL_IsBusy() == true)
+    {
+        return;
+    }
+
+    if (NVMCTRL_ErrorGet() & FLASH_ERROR_MASK)
+    {
+        flash_error = true;
+    }
+
+    if (journal_pending == true)
+    {
+        /* The page write is completed: the page is committed */
+        if (flash_error == false)
+        {
+            NVMCTRL_QuadWordWrite(journal_entry, journal_next);
+            journal_next += JOURNAL_ENTRY_SIZE;
+        }
+        journal_pending = false;
+    }
+    else if ((flash_page_ready[flash_program] == true) && (flash_page_addr[flash_program] < flash_erase_addr))
+    {
+        crc_stream_update((uint32_t *)&flash_data[flash_program][0], WORDS(PAGE_SIZE));
+
+        /* Write Page */
+        NVMCTRL_PageWrite((uint32_t *)&flash_data[flash_program][0], flash_page_addr[flash_program]);
+        journal_record(flash_page_addr[flash_program]);
+
+        flash_page_ready[flash_program] = false;
+        flash_program = (flash_program + 1) % FLASH_BUFFERS;
+    }
+    else if ((flash_erase_addr < flash_erase_end) &&
+             (flash_erase_addr <= ((flash_addr & OFFSET_ALIGN_MASK) + FLASH_ERASE_AHEAD)))
+    {
+        /* Lock region size is always bigger than the row size */
+        NVMCTRL_RegionUnlock(flash_erase_addr);
+
+        while(NVMCTRL_IsBusy() == true);
+
+        /* Erase the next sector */
+        NVMCTRL_BlockErase(flash_erase_addr);
+
+        flash_erase_addr += ERASE_BLOCK_SIZE;
+    }
+}
+
+/* Function to queue the filled page buffer for programming.
+   If the next buffer is still waiting for the NVMCTRL the function
+   keeps the pipeline running until it is free (flow control of the HOST) */
 static void flash_write(void)
 {
-    if (0 == (flash_addr % ERASE_BLOCK_SIZE))
-	{
-		/* Lock region size is always bigger than the row size */
-		NVMCTRL_RegionUnlock(flash_addr);
+    flash_page_addr[flash_fill] = flash_addr;
+    flash_page_ready[flash_fill] = true;
+    flash_fill = (flash_fill + 1) % FLASH_BUFFERS;
+
+    while (flash_page_ready[flash_fill] == true)
+    {
+        flash_task();
+    }
+}
+
+/* Function to complete all the pending flash operations */
+static void flash_flush(void)
+{
+    while ((flash_page_ready[flash_program] == true) || (journal_pending == true) || (NVMCTRL_IsBusy() == true))
+    {
+        flash_task();
+    }
+
+    if (NVMCTRL_ErrorGet() & FLASH_ERROR_MASK)
+    {
+        flash_error = true;
+    }
+}
+
+/* Function to restart the flash pipeline at the unlocked region */
+static void flash_reset(void)
+{
+    for (uint8_t i = 0; i < FLASH_BUFFERS; i++)
+    {
+        flash_page_ready[i] = false;
+    }
+    flash_fill = 0;
+    flash_program = 0;
+    flash_erase_addr = unlock_begin;
+    flash_erase_end = unlock_begin;
+    flash_error = false;
+
+    crc_stream_start(0xffffffff);
+}
+
+/* Function to start the journal of a new session: the journal rows are erased
+   and the header records the unlocked range. The journal is disabled if the
+   range overlaps the journal rows */
+static void journal_start(void)
+{
+    uint32_t header[4] = {JOURNAL_MAGIC, unlock_begin, unlock_end, ~(unlock_begin ^ unlock_end)};
+
+    journal_pending = false;
+    journal_next = JOURNAL_END;
+
+    if ((unlock_begin < JOURNAL_END) && (unlock_end > JOURNAL_START))
+    {
+        return;
+    }
+
+    for (uint32_t addr = JOURNAL_START; addr < JOURNAL_END; addr += ERASE_BLOCK_SIZE)
+    {
+        NVMCTRL_RegionUnlock(addr);
+        while (NVMCTRL_IsBusy() == true);
+
+        NVMCTRL_BlockErase(addr);
+        while (NVMCTRL_IsBusy() == true);
+    }
+
+    NVMCTRL_QuadWordWrite(header, JOURNAL_START);
+    while (NVMCTRL_IsBusy() == true);
+
+    journal_next = JOURNAL_START + JOURNAL_ENTRY_SIZE;
+}
+
+/* Function to find the first missing page of an interrupted session of the same range.
+   The entries are checked in order against the flash: the CRC is seeded with the
+   value of the last committed page and the page is read back, so a page not
+   completely programmed is detected. Entries of other pages (a partial entry or
+   a page committed again after a previous resume) are skipped.
+   If the block of the first missing page is not blank beyond it, the transfer
+   restarts from the start of the block, which is erased again.
+   On success the pipeline and the CRC continue from the returned page */
+static bool journal_resume(uint32_t begin, uint32_t end, uint32_t *resume_addr)
+{
+    uint32_t *header = (uint32_t *)FLASH_PTR(JOURNAL_START);
+    uint32_t addr = begin;
+    uint32_t crc = 0xffffffff;
+    uint32_t block_crc = crc;
+    uint32_t entry;
+
+    if ((header[0] != JOURNAL_MAGIC) || (header[1] != begin) || (header[2] != end) ||
+        (header[3] != ~(begin ^ end)))
+    {
+        return false;
+    }
+
+    for (entry = JOURNAL_START + JOURNAL_ENTRY_SIZE; entry < JOURNAL_END; entry += JOURNAL_ENTRY_SIZE)
+    {
+        uint32_t *e = (uint32_t *)FLASH_PTR(entry);
+
+        if ((e[0] & e[1] & e[2] & e[3]) == 0xffffffff)
+        {
+            break;
+        }
+        if ((addr >= end) || (e[0] != addr) || (e[2] != ~e[0]) || (e[3] != ~e[1]))
+        {
+            continue;
+        }
+
+        crc_stream_start(crc);
+        crc_stream_update((uint32_t *)FLASH_PTR(addr), WORDS(PAGE_SIZE));
+        if (crc_stream_result() != e[1])
+        {
+            continue;
+        }
+
+        crc = e[1];
+        addr += PAGE_SIZE;
+        if ((addr & (ERASE_BLOCK_SIZE - 1)) == 0)
+        {
+            block_crc = crc;
+        }
+    }
+
+    /* A page write interrupted by a reset leaves the page partially programmed */
+    for (uint32_t i = addr; (i < end) && (i < ((addr & OFFSET_ALIGN_MASK) + ERASE_BLOCK_SIZE)); i += sizeof(uint32_t))
+    {
+        if (*(uint32_t *)FLASH_PTR(i) != 0xffffffff)
+        {
+            addr &= OFFSET_ALIGN_MASK;
+            crc = block_crc;
+            break;
+        }
+    }
+
+    unlock_begin = begin;
+    unlock_end = end;
+    flash_reset();
+    crc_stream_start(crc);
+
+    /* The block of the resumed page is erased only if the page is the first one */
+    flash_erase_addr = ((addr & (ERASE_BLOCK_SIZE - 1)) == 0) ? addr : ((addr & OFFSET_ALIGN_MASK) + ERASE_BLOCK_SIZE);
+    flash_erase_end = end;
+    flash_addr = addr;
+    flash_size = end - (addr - begin);
+    flash_ptr = 0;
+
+    journal_pending = false;
+    journal_next = entry;
+
+    *resume_addr = addr;
+    return true;
+}
+
+/* Function to append a byte of the image to the page buffers.
+   A byte beyond the unlocked range is rejected: its page would never be
+   erased, so the pipeline would wait for it forever */
+static bool page_put(uint8_t value)
+{
+    if ((0 == flash_size) || (flash_addr >= unlock_end))
+    {
+        return false;
+    }
+
+    flash_data[flash_fill][flash_ptr++] = value;
+
+    if (flash_ptr == PAGE_SIZE)
+    {
+        flash_write();
+
+        flash_ptr = 0;
+        flash_addr += PAGE_SIZE;
+        flash_size -= PAGE_SIZE;
+    }
+    return true;
+}
+
+/* Function to read a byte of the image already received: from the page
+   being filled, from a page waiting for the NVMCTRL or from the flash */
+static uint8_t image_read(uint32_t addr)
+{
+    if (addr >= flash_addr)
+    {
+        return flash_data[flash_fill][addr - flash_addr];
+    }
+
+    for (uint8_t i = 0; i < FLASH_BUFFERS; i++)
+    {
+        if ((flash_page_ready[i] == true) && ((addr - flash_page_addr[i]) < PAGE_SIZE))
+        {
+            return flash_data[i][addr - flash_page_addr[i]];
+        }
+    }
+
+    return *FLASH_PTR(addr);
+}
+
+/* Function to copy an LZ4 match: the source is the image already written,
+   so the decoder window is the whole image without any RAM history buffer */
+static bool lz4_match_copy(void)
+{
+    lz4_state = LZ4_TOKEN;
+
+    while (lz4_length-- > 0)
+    {
+        if (page_put(image_read(flash_addr + flash_ptr - lz4_offset)) == false)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Function to decode a byte of an LZ4 block stream (raw block format, without
+   frame header and size): literal runs are copied into the page buffers,
+   matches (offset up to 64 KB) are copied from the image already decoded */
+static bool lz4_decode(uint8_t value)
+{
+    switch (lz4_state)
+    {
+        case LZ4_TOKEN:
+            lz4_token = value;
+            lz4_length = value >> 4;
+            if (0 == lz4_length)
+            {
+                lz4_state = LZ4_OFFSET_LOW;
+            }
+            else
+            {
+                lz4_state = (15 == lz4_length) ? LZ4_LITERAL_LENGTH : LZ4_LITERALS;
+            }
+            return true;
+
+        case LZ4_LITERAL_LENGTH:
+            lz4_length += value;
+            if (value != 255)
+            {
+                lz4_state = LZ4_LITERALS;
+            }
+            return true;
+
+        case LZ4_LITERALS:
+            if (--lz4_length == 0)
+            {
+                lz4_state = LZ4_OFFSET_LOW;
+            }
+            return page_put(value);
+
+        case LZ4_OFFSET_LOW:
+            lz4_offset = value;
+            lz4_state = LZ4_OFFSET_HIGH;
+            return true;
+
+        case LZ4_OFFSET_HIGH:
+            lz4_offset |= ((uint32_t)value << 8);
+            if ((0 == lz4_offset) || (lz4_offset > (flash_addr + flash_ptr - unlock_begin)))
+            {
+                return false;
+            }
+
+            lz4_length = (lz4_token & 0x0f) + 4;
+            if ((lz4_token & 0x0f) == 15)
+            {
+                lz4_state = LZ4_MATCH_LENGTH;
+                return true;
+            }
+            return lz4_match_copy();
+
+        case LZ4_MATCH_LENGTH:
+            lz4_length += value;
+            if (value == 255)
+            {
+                return true;
+            }
+            return lz4_match_copy();
+
+        default:
+            return false;
+    }
+}
+
+/* Function to check the installed image before a delta update:
+   the release word and the CRC of the unlocked range shall match the base of the delta */
+static bool delta_base_check(uint32_t release, uint32_t crc)
+{
+    if (*(uint32_t *)FLASH_PTR(_MET_BOOTLOADER_APP_RELEASE_OFFSET) != release)
+    {
+        return false;
+    }
+    return (crc_generate() == crc);
+}
+
+/* Function to start the patch of the block at the write pointer.
+   The installed block is copied in RAM and only this block is erased */
+static void delta_block_start(void)
+{
+    flash_flush();
+
+    delta_block_addr = flash_addr;
+    memcpy(delta_block, FLASH_PTR(delta_block_addr), ERASE_BLOCK_SIZE);
+
+    flash_erase_addr = delta_block_addr;
+    flash_erase_end = delta_block_addr + ERASE_BLOCK_SIZE;
+    delta_patch = true;
+}
+
+/* Function to skip blocks identical to the installed image: they are neither
+   erased nor written, and they are added to the running CRC from the flash */
+static bool delta_block_skip(uint32_t count)
+{
+    uint32_t length = count * ERASE_BLOCK_SIZE;
 
-		while(NVMCTRL_IsBusy() == true);
+    if ((0 == count) || ((flash_addr + length) > unlock_end))
+    {
+        return false;
+    }
 
-		/* Erase the Current sector */
-		NVMCTRL_BlockErase(flash_addr);
+    flash_flush();
+    crc_stream_update((uint32_t *)FLASH_PTR(flash_addr), WORDS(length));
 
-		while(NVMCTRL_IsBusy() == true);
-	}
+    flash_addr += length;
+    flash_size -= length;
+    return true;
+}
 
-    /* Write Page */
-    NVMCTRL_PageWrite((uint32_t *)&flash_data[0], flash_addr);
+/* Function to append a byte to the patched block */
+static bool delta_put(uint8_t value)
+{
+    if (page_put(value) == false)
+    {
+        return false;
+    }
 
-    while(NVMCTRL_IsBusy() == true);
+    /* The last page of the block is queued */
+    if ((flash_addr + flash_ptr) == (delta_block_addr + ERASE_BLOCK_SIZE))
+    {
+        delta_patch = false;
+    }
+    return true;
+}
+
+/* Function to decode a byte of a delta stream. The stream is a list of records:
+   - DELTA_BLOCK_SKIP, count: blocks unchanged;
+   - DELTA_BLOCK_PATCH: the next block is rewritten with the following records,
+     up to the end of the block:
+     - DELTA_COPY, length (16 bit): bytes unchanged (same address in the installed image);
+     - DELTA_DATA, length (16 bit), bytes: new bytes.
+   Only the changed blocks are erased and written */
+static bool delta_decode(uint8_t value)
+{
+    switch (delta_state)
+    {
+        case DELTA_RECORD:
+            delta_record = value;
+            if ((DELTA_BLOCK_SKIP == value) && (delta_patch == false))
+            {
+                delta_state = DELTA_SKIP_COUNT;
+                return true;
+            }
+            if ((DELTA_BLOCK_PATCH == value) && (delta_patch == false) && (flash_addr < unlock_end))
+            {
+                delta_block_start();
+                return true;
+            }
+            if (((DELTA_COPY == value) || (DELTA_DATA == value)) && (delta_patch == true))
+            {
+                delta_state = DELTA_LENGTH_LOW;
+                return true;
+            }
+            return false;
+
+        case DELTA_SKIP_COUNT:
+            delta_state = DELTA_RECORD;
+            return delta_block_skip(value);
+
+        case DELTA_LENGTH_LOW:
+            delta_length = value;
+            delta_state = DELTA_LENGTH_HIGH;
+            return true;
+
+        case DELTA_LENGTH_HIGH:
+            delta_length |= ((uint32_t)value << 8);
+            if ((0 == delta_length) ||
+                (delta_length > ((delta_block_addr + ERASE_BLOCK_SIZE) - (flash_addr + flash_ptr))))
+            {
+                return false;
+            }
+
+            if (DELTA_DATA == delta_record)
+            {
+                delta_state = DELTA_BYTES;
+                return true;
+            }
+
+            delta_state = DELTA_RECORD;
+            while (delta_length-- > 0)
+            {
+                if (delta_put(delta_block[(flash_addr + flash_ptr) - delta_block_addr]) == false)
+                {
+                    return false;
+                }
+            }
+            return true;
+
+        case DELTA_BYTES:
+            if (--delta_length == 0)
+            {
+                delta_state = DELTA_RECORD;
+            }
+            return delta_put(value);
+
+        default:
+            return false;
+    }
+}
+
+/* Function to store the data of a frame according to the image format */
+static bool data_store(uint8_t *frame_data, uint32_t size)
+{
+    /* Full image: the unlocked range is erased ahead of the data */
+    if (FORMAT_DELTA != image_format)
+    {
+        flash_erase_end = unlock_end;
+    }
+
+    for (uint8_t i = 0; i < size; i++)
+    {
+        bool stored;
+
+        if (FORMAT_LZ4 == image_format)
+        {
+            stored = lz4_decode(frame_data[i]);
+        }
+        else if (FORMAT_DELTA == image_format)
+        {
+            stored = delta_decode(frame_data[i]);
+        }
+        else
+        {
+            stored = page_put(frame_data[i]);
+        }
+
+        if (stored == false)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Function to send a window response: BL_RESP_ACK with the next expected
+   sequence or BL_RESP_NACK with the missing sequence. In both cases all
+   the previous frames are received */
+static void window_response(uint8_t response)
+{
+    uint8_t tx_data[2] = {response, data_seq};
+
+    window_acked = data_seq;
+    _MessageTransmit(_FILTER_ID, 2, tx_data, _MODE_FD_WITH_BRS, _MSG_ATTR_TX_FIFO_DATA_FRAME);
+}
+
+/* Function to clear the out of order frames */
+static void window_reset(void)
+{
+    for (uint8_t i = 0; i < WINDOW_MAX; i++)
+    {
+        window_valid[i] = false;
+    }
+    window_acked = data_seq;
+    window_nack = false;
+}
+
+/* Function to receive a data frame in sliding window mode.
+   - The expected frame is stored together with the following ones
+     already received: the ack is cumulative, every half window and
+     when a gap is filled.
+   - A frame after a gap is kept and the missing sequence is
+     NACKed once: the HOST retransmits only that frame.
+   - A frame already received (lost ack) is acked again */
+static void window_data_receive(uint8_t seq, uint8_t *frame_data, uint32_t size)
+{
+    uint8_t offset = (uint8_t)(seq - data_seq);
+    uint8_t slot = seq % WINDOW_MAX;
+    bool gap_filled = false;
+
+    if (offset >= (uint8_t)(256 - WINDOW_MAX))
+    {
+        window_response(BL_RESP_ACK);
+        return;
+    }
+
+    if (offset >= window_size)
+    {
+        uint8_t tx_message = BL_RESP_SEQ_ERROR;
+        _MessageTransmit(_FILTER_ID, 1, &tx_message, _MODE_FD_WITH_BRS, _MSG_ATTR_TX_FIFO_DATA_FRAME);
+        return;
+    }
+
+    if (offset > 0)
+    {
+        memcpy(window_data[slot], frame_data, size);
+        window_length[slot] = size;
+        window_valid[slot] = true;
+
+        if (window_nack == false)
+        {
+            window_nack = true;
+            window_response(BL_RESP_NACK);
+        }
+        return;
+    }
+
+    if (data_store(frame_data, size) == false)
+    {
+        uint8_t tx_message = BL_RESP_ERROR;
+        _MessageTransmit(_FILTER_ID, 1, &tx_message, _MODE_FD_WITH_BRS, _MSG_ATTR_TX_FIFO_DATA_FRAME);
+        return;
+    }
+    data_seq++;
+
+    /* Frames already received after the gap */
+    while (window_valid[data_seq % WINDOW_MAX] == true)
+    {
+        slot = data_seq % WINDOW_MAX;
+        window_valid[slot] = false;
+        gap_filled = true;
+
+        if (data_store(window_data[slot], window_length[slot]) == false)
+        {
+            uint8_t tx_message = BL_RESP_ERROR;
+            _MessageTransmit(_FILTER_ID, 1, &tx_message, _MODE_FD_WITH_BRS, _MSG_ATTR_TX_FIFO_DATA_FRAME);
+            return;
+        }
+        data_seq++;
+    }
+
+    if (window_nack == true)
+    {
+        window_nack = false;
+        for (uint8_t i = 0; i < WINDOW_MAX; i++)
+        {
+            if (window_valid[i] == true)
+            {
+                /* Another gap */
+                window_nack = true;
+                window_response(BL_RESP_NACK);
+                return;
+            }
+        }
+    }
+
+    if ((gap_filled == true) || ((uint8_t)(data_seq - window_acked) >= ((window_size + 1) / 2)))
+    {
+        window_response(BL_RESP_ACK);
+    }
+}
+
+/* Function to start the data stream of a session: stop-and-wait and
+   raw image until the next BL_CMD_WINDOW and BL_CMD_FORMAT */
+static void session_reset(void)
+{
+    data_seq = 0;
+    window_size = 0;
+    window_reset();
+    image_format = FORMAT_RAW;
+    lz4_state = LZ4_TOKEN;
+    delta_state = DELTA_RECORD;
+    delta_patch = false;
 }
 
 /* Function to process command from the received message */
@@ -185,10 +956,14 @@ static void process_command(uint8_t *rx_message, uint8_t rx_messageLength)
 
         uint32_t end    = begin + (data[SIZE_OFFSET] & SIZE_ALIGN_MASK);
 
+        /* Completes the pages of a previous session */
+        flash_flush();
+
         if (end > begin && end <= (FLASH_START + FLASH_LENGTH) && size == (OFFSET_SIZE + SIZE_SIZE))
         {
             unlock_begin = begin;
             unlock_end = end;
+            journal_start();
             tx_message = BL_RESP_OK;
             _MessageTransmit(_FILTER_ID, 1, &tx_message, _MODE_FD_WITH_BRS, _MSG_ATTR_TX_FIFO_DATA_FRAME);
         }
@@ -196,62 +971,152 @@ static void process_command(uint8_t *rx_message, uint8_t rx_messageLength)
         {
             unlock_begin = 0;
             unlock_end = 0;
+            journal_pending = false;
+            journal_next = JOURNAL_END;
             tx_message = BL_RESP_ERROR;
             _MessageTransmit(_FILTER_ID, 1, &tx_message, _MODE_FD_WITH_BRS, _MSG_ATTR_TX_FIFO_DATA_FRAME);
         }
-        data_seq = 0;
         flash_ptr = 0;
         flash_addr = unlock_begin;
-        flash_size = unlock_end;
+        flash_size = unlock_end - unlock_begin;
+        flash_reset();
+        session_reset();
     }
     else if (BL_CMD_DATA == command)
     {
-        if (rx_message[HEADER_SEQ_OFFSET] != data_seq)
+        if (flash_error == true)
+        {
+            tx_message = BL_RESP_ERROR;
+            _MessageTransmit(_FILTER_ID, 1, &tx_message, _MODE_FD_WITH_BRS, _MSG_ATTR_TX_FIFO_DATA_FRAME);
+        }
+        else if (window_size > 0)
+        {
+            window_data_receive(rx_message[HEADER_SEQ_OFFSET], &rx_message[HEADER_SIZE], size);
+        }
+        else if (rx_message[HEADER_SEQ_OFFSET] != data_seq)
         {
             tx_message = BL_RESP_SEQ_ERROR;
             _MessageTransmit(_FILTER_ID, 1, &tx_message, _MODE_FD_WITH_BRS, _MSG_ATTR_TX_FIFO_DATA_FRAME);
         }
         else
         {
-            for (uint8_t i = 0; i < size; i++)
+            if (data_store(&rx_message[HEADER_SIZE], size) == false)
             {
-                if (0 == flash_size)
-                {
-                    tx_message = BL_RESP_ERROR;
-                    _MessageTransmit(_FILTER_ID, 1, &tx_message, _MODE_FD_WITH_BRS, _MSG_ATTR_TX_FIFO_DATA_FRAME);
-                    return;
-                }
-
-                flash_data[flash_ptr++] = rx_message[HEADER_SIZE + i];
-
-                if (flash_ptr == PAGE_SIZE)
-                {
-                    flash_write();
-
-                    flash_ptr = 0;
-                    flash_addr += PAGE_SIZE;
-                    flash_size -= PAGE_SIZE;
-                }
+                tx_message = BL_RESP_ERROR;
+                _MessageTransmit(_FILTER_ID, 1, &tx_message, _MODE_FD_WITH_BRS, _MSG_ATTR_TX_FIFO_DATA_FRAME);
+                return;
             }
+            /* The ack doesn't wait for the flash operations:
+               the pipeline runs while the next frame is received */
             data_seq++;
             tx_message = BL_RESP_OK;
             _MessageTransmit(_FILTER_ID, 1, &tx_message, _MODE_FD_WITH_BRS, _MSG_ATTR_TX_FIFO_DATA_FRAME);
         }
     }
+    else if (BL_CMD_WINDOW == command)
+    {
+        /* Sets the window size (0 = stop-and-wait) and returns the cumulative ack:
+           the HOST sends it again to poll the ack of the last frames */
+        uint8_t window = rx_message[WINDOW_SIZE_OFFSET];
+
+        if ((size != 1) || (window > WINDOW_MAX))
+        {
+            tx_message = BL_RESP_ERROR;
+            _MessageTransmit(_FILTER_ID, 1, &tx_message, _MODE_FD_WITH_BRS, _MSG_ATTR_TX_FIFO_DATA_FRAME);
+        }
+        else
+        {
+            if (window < window_size)
+            {
+                window_reset();
+            }
+            window_size = window;
+            window_response(BL_RESP_ACK);
+        }
+    }
+    else if (BL_CMD_FORMAT == command)
+    {
+        /* Selects the format of the BL_CMD_DATA stream: only before the first data frame.
+           FORMAT_DELTA payload: format, 3 bytes padding, base release word, base CRC */
+        uint8_t format = rx_message[FORMAT_OFFSET];
+
+        if ((format > FORMAT_DELTA) || (size != ((FORMAT_DELTA == format) ? FORMAT_DELTA_SIZE : 1)) ||
+            (flash_addr != unlock_begin) || (flash_ptr != 0))
+        {
+            tx_message = BL_RESP_ERROR;
+        }
+        else if ((FORMAT_DELTA == format) &&
+                 (delta_base_check(data[DELTA_RELEASE_OFFSET], data[DELTA_CRC_OFFSET]) == false))
+        {
+            /* The HOST shall send the full image */
+            tx_message = BL_RESP_CRC_FAIL;
+        }
+        else
+        {
+            image_format = format;
+            lz4_state = LZ4_TOKEN;
+            delta_state = DELTA_RECORD;
+            delta_patch = false;
+            tx_message = BL_RESP_OK;
+        }
+        _MessageTransmit(_FILTER_ID, 1, &tx_message, _MODE_FD_WITH_BRS, _MSG_ATTR_TX_FIFO_DATA_FRAME);
+    }
+    else if (BL_CMD_RESUME == command)
+    {
+        /* Same payload as BL_CMD_UNLOCK: the response is BL_RESP_RESUME and the address
+           of the first missing page (little endian). The HOST continues the raw image
+           from that address with a new data sequence */
+        uint32_t begin  = (data[ADDR_OFFSET] & OFFSET_ALIGN_MASK);
+        uint32_t end    = begin + (data[SIZE_OFFSET] & SIZE_ALIGN_MASK);
+        uint32_t resume_addr = 0;
+
+        flash_flush();
+
+        if ((size == RESUME_SIZE) && (journal_resume(begin, end, &resume_addr) == true))
+        {
+            uint8_t tx_data[RESUME_RESP_SIZE] = {BL_RESP_RESUME, (uint8_t)resume_addr, (uint8_t)(resume_addr >> 8),
+                                                 (uint8_t)(resume_addr >> 16), (uint8_t)(resume_addr >> 24)};
+
+            session_reset();
+            _MessageTransmit(_FILTER_ID, RESUME_RESP_SIZE, tx_data, _MODE_FD_WITH_BRS, _MSG_ATTR_TX_FIFO_DATA_FRAME);
+        }
+        else
+        {
+            /* No journal of this range: the HOST shall start from BL_CMD_UNLOCK */
+            tx_message = BL_RESP_ERROR;
+            _MessageTransmit(_FILTER_ID, 1, &tx_message, _MODE_FD_WITH_BRS, _MSG_ATTR_TX_FIFO_DATA_FRAME);
+        }
+    }
     else if (BL_CMD_VERIFY == command)
     {
         uint32_t crc        = data[CRC_OFFSET];
         uint32_t crc_gen    = 0;
+        uint8_t  flags      = (size > CRC_SIZE) ? rx_message[VERIFY_FLAGS_OFFSET] : 0;
 
-        if (size != CRC_SIZE)
+        if ((size != CRC_SIZE) && (size != (CRC_SIZE + 1)))
         {
             tx_message = BL_RESP_ERROR;
             _MessageTransmit(_FILTER_ID, 1, &tx_message, _MODE_FD_WITH_BRS, _MSG_ATTR_TX_FIFO_DATA_FRAME);
+            return;
         }
 
-        crc_gen = crc_generate();
+        flash_flush();
 
-        if (crc == crc_gen)
+        /* The unlocked range not received is read from the flash,
+           so the value is the CRC of the whole range as with the DSU */
+        if (flash_addr < unlock_end)
+        {
+            crc_stream_update((uint32_t *)FLASH_PTR(flash_addr), WORDS(unlock_end - flash_addr));
+        }
+        crc_gen = crc_stream_result();
+
+        /* Optional post-flash check: CRC of the programmed flash with the DSU */
+        if ((crc == crc_gen) && (flags & VERIFY_READBACK))
+        {
+            crc_gen = crc_generate();
+        }
+
+        if ((crc == crc_gen) && (flash_error == false))
         {
             tx_message = BL_RESP_CRC_OK;
             _MessageTransmit(_FILTER_ID, 1, &tx_message, _MODE_FD_WITH_BRS, _MSG_ATTR_TX_FIFO_DATA_FRAME);
@@ -264,6 +1129,8 @@ static void process_command(uint8_t *rx_message, uint8_t rx_messageLength)
     }
     else if (BL_CMD_RESET == command)
     {
+        flash_flush();
+
         tx_message = BL_RESP_OK;
 
         if (_InterruptGet(_INTERRUPT_TFE_MASK))
@@ -290,22 +1157,34 @@ static void _task(void)
     uint8_t                    rx_messageLength = 0;
     _MSG_RX_FRAME_ATTRIBUTE msgFrameAttr = _MSG_RX_DATA_FRAME;
 
+    /* Erases and page writes run in background of the reception */
+    flash_task();
+
     if (_InterruptGet(_INTERRUPT_RF0N_MASK))
     {
+        /* RF0N flags the first new message only: a window fills the FIFO with
+           several frames, so the FIFO is read until it is empty. A frame
+           received after the clear sets RF0N again */
         _InterruptClear(_INTERRUPT_RF0N_MASK);
 
-        /* Check  Status */
-        status = _ErrorGet();
-        if (((status & _PSR_LEC_Msk) == _ERROR_NONE) || ((status & _PSR_LEC_Msk) == _ERROR_LEC_NO_CHANGE))
+        while (RX_FIFO0_LEVEL() != 0)
         {
+            /* Check  Status */
+            status = _ErrorGet();
+            if (((status & _PSR_LEC_Msk) != _ERROR_NONE) && ((status & _PSR_LEC_Msk) != _ERROR_LEC_NO_CHANGE))
+            {
+                break;
+            }
+
             memset(rx_message, 0x00, sizeof(rx_message));
 
             /* Receive FIFO 0 New Message */
-            if (_MessageReceive(&rx_messageID, &rx_messageLength, rx_message, 0, _MSG_ATTR_RX_FIFO0, &msgFrameAttr) == true)
+            if (_MessageReceive(&rx_messageID, &rx_messageLength, rx_message, 0, _MSG_ATTR_RX_FIFO0, &msgFrameAttr) == false)
             {
-                process_command(rx_message, rx_messageLength);
-                (void)rx_messageID;
+                break;
             }
+            process_command(rx_message, rx_messageLength);
+            (void)rx_messageID;
         }
     }
 }
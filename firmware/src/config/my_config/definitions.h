@@ -60,6 +60,7 @@
 #include "peripheral/rtc/plib_rtc.h"
 #include "peripheral/tc/plib_tc0.h"
 #include "peripheral/dsu/plib_dsu.h"
+#include "peripheral/dmac/plib_dmac.h"
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
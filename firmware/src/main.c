@@ -31,6 +31,15 @@
 #include "Filter/filter.h"
 #include "XrayTube/xray_tube.h"
 #include "PowerLed/power_led.h"
+#include "Storage/storage.h"
+#include "History/history.h"
+#include "Profiler/profiler.h"
+#include "Diagnostic/diagnostic.h"
+#include "PowerSave/power_save.h"
+#include "Update/update.h"
+#include "Boot/boot.h"
+#include "Log/log.h"
+#include "timers.h"
 
 
 
@@ -41,21 +50,25 @@
 // Section: Main Entry Point
 // *****************************************************************************
 // *****************************************************************************
-static volatile uint8_t trigger_time = 0;
-
-#define _1024_ms_TriggerTime 0x1
-#define _7820_us_TriggerTime 0x2
-#define _15_64_ms_TriggerTime 0x4
-
 
 static void rtcEventHandler (RTC_TIMER32_INT_MASK intCause, uintptr_t context)
 {
-    // Periodic Interval Handler: Freq = 1024 / 2 ^ (n+3)
+    PROFILER_START(PROFILER_PROBE_RTC_EVENT);
     
-    if (intCause & RTC_TIMER32_INT_MASK_PER0) trigger_time |= _7820_us_TriggerTime;  // 7.82ms Interrupt
-    if (intCause & RTC_TIMER32_INT_MASK_PER1) trigger_time |= _15_64_ms_TriggerTime; // 15.64ms Interrupt
-    if (intCause & RTC_TIMER32_INT_MASK_PER7) trigger_time |= _1024_ms_TriggerTime;  // 1024 ms Interrupt
+    // Power light timeout: the Protocol task updates the status flag
+    if (intCause & RTC_TIMER32_INT_MASK_CMP0){
+        PowerLedTimeoutEvent();
+        ApplicationProtocolNotify();
+    }
     
+    PROFILER_STOP(PROFILER_PROBE_RTC_EVENT);
+}
+
+/**
+ * This is the vitality led timer callback (1s)
+ */
+static void vitalityTimerCallback(TimerHandle_t timer){
+    VITALITY_LED_Toggle();            
 }
 
 int main ( void )
@@ -64,6 +77,15 @@ int main ( void )
     /* Initialize all modules */
     SYS_Initialize ( NULL );
     
+    // Execution time probes (debug build)
+    ProfilerInit();
+    
+    // Binary diagnostic log (SERCOM5 TX)
+    LogInit();
+    
+    // The idle task waits the interrupts in IDLE sleep mode
+    PM_REGS->PM_SLEEPCFG = PM_SLEEPCFG_SLEEPMODE_IDLE;
+    while((PM_REGS->PM_SLEEPCFG & PM_SLEEPCFG_SLEEPMODE_Msk) != PM_SLEEPCFG_SLEEPMODE_IDLE);
   
     // Registers the RTC interrupt routine to the RTC module
     RTC_Timer32CallbackRegister(rtcEventHandler, 0);
@@ -73,47 +95,30 @@ int main ( void )
     // Application Protocol initialization
     ApplicationProtocolInit();
     
-    // Modules initialization
+    // Modules initialization: a failed firmware trial is rolled back first
+    UpdateInit();
+    HistoryInit();
     PowerLedInit();
     FilterInit();
     XrayInit();
+    PowerSaveInit();
     
-    while ( true )
-    {
-        /* Maintain state machines of all polled MPLAB Harmony modules. */
-        SYS_Tasks ( );
-        
-        // Protocol management
-        ApplicationProtocolLoop();
-        
-        
-       
-                
-        // Timer events activated into the RTC interrupt
-        if(trigger_time & _7820_us_TriggerTime){
-            trigger_time &=~ _7820_us_TriggerTime;
-            FilterTest();
-            
-        }
-
-        if(trigger_time & _15_64_ms_TriggerTime){
-            trigger_time &=~ _15_64_ms_TriggerTime;      
-            PowerLedLoop();
-            
-        }
-        
-        
-                
-        if(trigger_time & _1024_ms_TriggerTime){
-            trigger_time &=~ _1024_ms_TriggerTime;
-            
-            XrayLoop();            
-            VITALITY_LED_Toggle();            
-            
-        }        
-     
-
-    }
+    // Application tasks: the Protocol task has the highest priority
+    TaskHandle_t task;
+    DiagnosticInit();
+    xTaskCreate(ApplicationProtocolTask, "PROTOCOL", PROTOCOL_TASK_STACK, NULL, PROTOCOL_TASK_PRIORITY, &task);
+    DiagnosticAddTask(DIAGNOSTIC_TASK_PROTOCOL, task, PROTOCOL_TASK_STACK);
+    xTaskCreate(FilterTask, "MOTION", FILTER_TASK_STACK, NULL, FILTER_TASK_PRIORITY, &task);
+    DiagnosticAddTask(DIAGNOSTIC_TASK_MOTION, task, FILTER_TASK_STACK);
+    xTaskCreate(XrayTask, "THERMAL", XRAY_TASK_STACK, NULL, XRAY_TASK_PRIORITY, &task);
+    DiagnosticAddTask(DIAGNOSTIC_TASK_THERMAL, task, XRAY_TASK_STACK);
+    
+    // Vitality led timer
+    xTimerStart(xTimerCreate("LED", pdMS_TO_TICKS(1000), pdTRUE, NULL, vitalityTimerCallback), 0);
+    BootStage(BOOT_STAGE_MODULES);
+    
+    /* Starts the RTOS scheduler: the function never returns */
+    SYS_Tasks ( );
 
     
     /* Execution should not come here during normal operation */
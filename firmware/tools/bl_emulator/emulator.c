@@ -0,0 +1,1055 @@
+/*
+ * Host emulator and update throughput benchmark of the CAN bootloader
+ *
+ * The config/my_config/bootloader/bootloader.c source is compiled on the host
+ * against the mocks of the NVMCTRL, DMAC/DSU CRC engines and CAN (see mock/):
+ * the bootloader _task() runs in a discrete time simulation (1us per iteration)
+ * and the flash is a 1MB array read through FLASH_PTR().
+ *
+ * NVM model (typical SAM E51 timings, overridable):
+ * - block erase 12ms, page write 2.5ms, quad word write 0.1ms;
+ * - programming can only clear bits: a quad word programmed twice
+ *   without erase is counted as a program error (PROGE);
+ * - the bootloader executes from the bank A: an operation in the bank A
+ *   stalls the CPU until its end (-c: the loop runs from the cache, no stall).
+ *   The CAN controller keeps receiving into the RX FIFO0 during the stall.
+ *
+ * Virtual CAN link: a single bus shared by the host and the device,
+ * the frames are serialized in transmission order (no arbitration).
+ * The frame time of CAN FD with 11 bit identifiers is:
+ * - nominal bitrate: arbitration field (17 bits) + CRC delimiter, ACK, EOF and IFS (13 bits);
+ * - data bitrate with BRS (nominal otherwise): ESI, DLC, data, stuff count,
+ *   CRC (17/21 bits) and its fixed stuff bits;
+ * - dynamic stuff bits: 10% of the arbitration, control and data fields.
+ * The payload is rounded up to the FD DLC sizes. A lost frame (-l, both directions)
+ * still takes the bus time. The device RX FIFO0 has -q elements:
+ * frames received while it is full are lost.
+ *
+ * The scripted host uploader (USB-CAN adapter turnaround -L) sends:
+ * UNLOCK, WINDOW (-w > 0), FORMAT (-f lz4|delta), the DATA frames (60 bytes)
+ * and VERIFY with the CRC of the unlocked range.
+ * - stop-and-wait: a frame is repeated after the timeout; a SEQ_ERROR answer
+ *   to a repetition means the frame was received (response lost);
+ * - sliding window: the NACKed frame is repeated, the cumulative ack is polled
+ *   with WINDOW after the last frame and after a timeout;
+ * - every command is repeated up to HOST_RETRIES times.
+ * With -r the device loses the power when the given share of the image is sent:
+ * the NVM operation in progress is left incomplete, the host waits the restart
+ * and continues the transfer with RESUME.
+ *
+ * The image is a synthetic firmware-like image (-S KB, -s seed) or a binary file (-i).
+ * The delta update (-f delta) starts from an installed base image: a file (-b)
+ * or the synthetic image with -p% of the blocks changed.
+ *
+ * For every run the emulator reports the end-to-end update time, the throughput,
+ * the bus utilisation, the retries and timeouts, the RX FIFO overflows and the NVM
+ * activity; with -x the update is repeated for a set of frame loss rates
+ * (retry sensitivity). With -t the full window test runs before the update:
+ * a window of data frames is queued in the RX FIFO0 before a single _task() call
+ * and the bootloader must store all of them.
+ *
+ * usage: bl_emulator [-S KB] [-i image.bin] [-b base.bin] [-f raw|lz4|delta] [-p changed%]
+ *                    [-w window] [-n nominal_kbps] [-d data_kbps] [-m fd|brs] [-l loss%]
+ *                    [-L latency_us] [-T timeout_ms] [-q fifo] [-E erase_ms] [-P page_ms]
+ *                    [-Q quad_us] [-c] [-r resume%] [-s seed] [-x] [-t]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "definitions.h"
+#include "config/my_config/bootloader/bootloader.c"
+
+#define SIM_LOOP_TIME       1.0         //!< Time (us) of a bootloader loop iteration
+#define SIM_BOOT_TIME       20000.0     //!< Restart time (us) after a power loss
+#define SIM_LIMIT           600e6       //!< Max simulated time (us)
+#define SIM_EVENTS          512
+
+#define IMAGE_BASE          0x2000      //!< Image start address (application ROM origin)
+#define IMAGE_MAX           (JOURNAL_START - IMAGE_BASE)
+
+#define HOST_RETRIES        16          //!< Max repetitions of a command
+#define HOST_CMD_TIMEOUT    500000.0    //!< Timeout (us) of UNLOCK, RESUME, FORMAT and VERIFY
+
+/// Simulation events
+typedef enum{
+    EV_TO_DEVICE = 0,   //!< End of a host frame
+    EV_TO_HOST,         //!< End of a device frame (+ host turnaround)
+    EV_TIMEOUT,         //!< Host response timeout
+    EV_POWER_ON,        //!< End of the device restart
+}SIM_EVENT_TYPE_t;
+
+typedef struct{
+    double t;
+    SIM_EVENT_TYPE_t type;
+    uint32_t gen;           //!< Timer generation (EV_TIMEOUT)
+    MOCK_CAN_FRAME_t frame;
+}SIM_EVENT_t;
+
+/// Run configuration
+typedef struct{
+    uint32_t nominal;       //!< Nominal bitrate (bit/s)
+    uint32_t data;          //!< Data bitrate (bit/s)
+    bool brs;               //!< Bit rate switch
+    double loss;            //!< Frame loss probability
+    double latency;         //!< Host turnaround (us)
+    double timeout;         //!< DATA and WINDOW response timeout (us)
+    uint8_t window;         //!< Sliding window size (0 = stop-and-wait)
+    uint8_t format;         //!< FORMAT_RAW, FORMAT_LZ4 or FORMAT_DELTA
+    double resume;          //!< Share of the image sent at the power loss (0 = none)
+    uint32_t seed;
+}SIM_CFG_t;
+
+/// Run statistics
+typedef struct{
+    double busBusy;         //!< Bus busy time (us)
+    uint32_t hostFrames;
+    uint32_t deviceFrames;
+    uint32_t lost;          //!< Frames lost on the link
+    uint32_t retries;       //!< Repeated commands and data frames
+    uint32_t timeouts;
+    uint32_t polls;         //!< WINDOW ack polls
+    uint32_t nacks;
+    uint32_t acksLost;      //!< SEQ_ERROR answers to a repeated frame
+    uint32_t resumeAddr;
+}SIM_STATS_t;
+
+/// Host uploader steps
+typedef enum{
+    HOST_UNLOCK = 0,
+    HOST_RESUME,
+    HOST_WINDOW,
+    HOST_FORMAT,
+    HOST_DATA,
+    HOST_VERIFY,
+    HOST_DONE,
+    HOST_FAILED,
+}HOST_STEP_t;
+
+/// Host uploader status
+typedef struct{
+    HOST_STEP_t step;
+    uint32_t offset;        //!< Stream offset of the data sequence 0
+    uint32_t chunks;        //!< Data frames from the offset
+    uint32_t base;          //!< First data frame not acked
+    uint32_t next;          //!< Next data frame to be sent (window mode)
+    bool polling;           //!< A WINDOW poll is waiting for the ack
+    double pollEnd;         //!< End of the poll frame
+    bool powerLoss;         //!< The power loss has been simulated
+    uint8_t retries;        //!< Repetitions of the current command
+    uint32_t answers;       //!< Data frame answers expected (stop-and-wait)
+    uint32_t gen;           //!< Timer generation
+    const char* error;
+    double end;
+}HOST_t;
+
+static double simNow;
+static SIM_EVENT_t events[SIM_EVENTS];
+static int eventCount;
+static double busFreeAt;
+static bool deviceOn;
+static bool powerLossPending;
+static uint32_t rng;
+
+static SIM_CFG_t cfg;
+static SIM_STATS_t stats;
+static HOST_t host;
+
+// Image and stream
+static uint8_t image[IMAGE_MAX];        //!< New image (padded to the page size)
+static uint8_t baseImage[IMAGE_MAX];    //!< Installed image
+static uint8_t stream[IMAGE_MAX * 2];   //!< DATA stream (raw, LZ4 or delta)
+static uint32_t imageLength;
+static uint32_t streamLength;
+static uint32_t imageCrc;
+static uint32_t baseCrc;
+static uint32_t baseRelease;
+
+static uint32_t random32(void){
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+/**
+ * CRC-32 (IEEE 802.3, reflected) seeded with 0xFFFFFFFF, without the final
+ * complement: the DSU value of the bootloader VERIFY.
+ */
+static uint32_t hostCrc(const uint8_t* data, uint32_t len){
+    uint32_t crc = 0xFFFFFFFF;
+
+    for(uint32_t i = 0; i < len; i++){
+        crc ^= data[i];
+        for(int j = 0; j < 8; j++){
+            if(crc & 1) crc = (crc >> 1) ^ 0xEDB88320;
+            else crc = crc >> 1;
+        }
+    }
+    return crc;
+}
+
+// Simulation engine
+
+double mockNow(void){
+    return simNow;
+}
+
+static void eventAdd(double t, SIM_EVENT_TYPE_t type, uint32_t gen, const MOCK_CAN_FRAME_t* frame){
+    if(eventCount >= SIM_EVENTS){
+        fprintf(stderr, "event queue overflow\n");
+        exit(1);
+    }
+
+    SIM_EVENT_t* ev = &events[eventCount++];
+    ev->t = t;
+    ev->type = type;
+    ev->gen = gen;
+    if(frame) ev->frame = *frame;
+}
+
+static void hostReceive(const MOCK_CAN_FRAME_t* frame);
+static void hostTimeout(void);
+static void hostPowerOn(void);
+
+/**
+ * Advances the time processing the events in order:
+ * called by the main loop and by the mocks while the bootloader waits.
+ */
+void mockAdvance(double us){
+    double target = simNow + us;
+
+    while(true){
+        int first = -1;
+        for(int i = 0; i < eventCount; i++){
+            if((events[i].t <= target) && ((first < 0) || (events[i].t < events[first].t))) first = i;
+        }
+        if(first < 0) break;
+
+        SIM_EVENT_t ev = events[first];
+        events[first] = events[--eventCount];
+        simNow = ev.t;
+
+        switch(ev.type){
+            case EV_TO_DEVICE:
+                if(deviceOn) mockCanDeliver(&ev.frame);
+                break;
+            case EV_TO_HOST:
+                hostReceive(&ev.frame);
+                break;
+            case EV_TIMEOUT:
+                if(ev.gen == host.gen) hostTimeout();
+                break;
+            case EV_POWER_ON:
+                hostPowerOn();
+                break;
+        }
+    }
+    simNow = target;
+}
+
+// Virtual CAN link
+
+/// Rounds the payload up to the CAN FD DLC sizes
+static uint8_t canFdLength(uint8_t length){
+    static const uint8_t sizes[] = {12, 16, 20, 24, 32, 48, 64};
+
+    if(length <= 8) return length;
+    for(unsigned i = 0; i < sizeof(sizes); i++){
+        if(length <= sizes[i]) return sizes[i];
+    }
+    return 64;
+}
+
+/// Frame time (us) of a CAN FD frame with 11 bit identifier
+static double canFdFrameTime(uint8_t length){
+    double crcBits = (length <= 16) ? 17 : 21;
+    double nominalBits = 17 + 13 + 0.1 * 17;
+    double dataBits = 1 + 4 + 8.0 * length + 4 + crcBits + (crcBits + 4) / 4 + 0.1 * (5 + 8.0 * length);
+    double dataRate = (cfg.brs) ? cfg.data : cfg.nominal;
+
+    return (nominalBits * 1e6 / cfg.nominal) + (dataBits * 1e6 / dataRate);
+}
+
+/**
+ * Queues a frame on the bus: the frame is delivered at the end of its
+ * transmission unless it is lost.
+ */
+static void busTransmit(MOCK_CAN_FRAME_t* frame, bool toDevice){
+    frame->length = canFdLength(frame->length);
+
+    double start = (simNow > busFreeAt) ? simNow : busFreeAt;
+    double end = start + canFdFrameTime(frame->length);
+    busFreeAt = end;
+    stats.busBusy += end - start;
+
+    bool lost = ((double) random32() / 4294967296.0) < cfg.loss;
+    if(lost) stats.lost++;
+
+    if(toDevice){
+        stats.hostFrames++;
+        if(!lost) eventAdd(end, EV_TO_DEVICE, 0, frame);
+    }else{
+        stats.deviceFrames++;
+        mockCan.txIdleAt = end;
+        if(!lost) eventAdd(end + cfg.latency, EV_TO_HOST, 0, frame);
+    }
+}
+
+void mockDeviceTransmit(const MOCK_CAN_FRAME_t* frame){
+    MOCK_CAN_FRAME_t f = *frame;
+    busTransmit(&f, false);
+}
+
+// Device
+
+/**
+ * Device reset: the RAM of the bootloader is cleared (.bss)
+ * and the CAN controller is restarted.
+ */
+static void deviceReset(void){
+    memset(flash_data, 0, sizeof(flash_data));
+    memset(flash_page_addr, 0, sizeof(flash_page_addr));
+    memset(flash_page_ready, 0, sizeof(flash_page_ready));
+    flash_fill = flash_program = 0;
+    flash_erase_addr = flash_erase_end = 0;
+    flash_error = false;
+    flash_addr = flash_size = flash_ptr = 0;
+    unlock_begin = unlock_end = 0;
+    data_seq = 0;
+    image_format = lz4_state = lz4_token = 0;
+    lz4_length = lz4_offset = 0;
+    delta_block_addr = delta_length = 0;
+    delta_patch = false;
+    delta_state = delta_record = 0;
+    journal_next = 0;
+    journal_pending = false;
+    window_size = window_acked = 0;
+    window_nack = false;
+    memset(window_valid, 0, sizeof(window_valid));
+
+    mockCan.get = mockCan.level = 0;
+    mockCan.rf0n = false;
+    mockCan.txIdleAt = 0;
+    _MessageRAMConfigSet(MessageRAM);
+}
+
+// Host uploader
+
+static void hostTimerStart(double timeout){
+    host.gen++;
+    eventAdd(simNow + timeout, EV_TIMEOUT, host.gen, NULL);
+}
+
+static void hostFail(const char* error){
+    host.step = HOST_FAILED;
+    host.error = error;
+    host.end = simNow;
+    host.gen++;
+}
+
+static void hostFrame(MOCK_CAN_FRAME_t* frame, uint8_t command, uint8_t seq, const uint8_t* payload, uint8_t size){
+    memset(frame, 0, sizeof(*frame));
+    frame->id = _FILTER_ID;
+    frame->data[HEADER_CMD_OFFSET] = command;
+    frame->data[HEADER_SEQ_OFFSET] = seq;
+    frame->data[HEADER_MAGIC_OFFSET] = HEADER_MAGIC;
+    frame->data[HEADER_SIZE_OFFSET] = size;
+    memcpy(&frame->data[HEADER_SIZE], payload, size);
+    frame->length = HEADER_SIZE + size;
+}
+
+static void hostSend(uint8_t command, uint8_t seq, const uint8_t* payload, uint8_t size){
+    MOCK_CAN_FRAME_t frame;
+
+    hostFrame(&frame, command, seq, payload, size);
+    busTransmit(&frame, true);
+}
+
+static void put32(uint8_t* p, uint32_t value){
+    p[0] = (uint8_t) value;
+    p[1] = (uint8_t) (value >> 8);
+    p[2] = (uint8_t) (value >> 16);
+    p[3] = (uint8_t) (value >> 24);
+}
+
+/// Sends a data frame of the stream from the current offset
+static void hostSendChunk(uint32_t chunk){
+    uint32_t pos = host.offset + chunk * MAX_DATA_SIZE;
+    uint32_t size = streamLength - pos;
+
+    if(size > MAX_DATA_SIZE) size = MAX_DATA_SIZE;
+    hostSend(BL_CMD_DATA, (uint8_t) chunk, &stream[pos], (uint8_t) size);
+    host.answers++;
+}
+
+/// Sends the command of the current step
+static void hostCommand(void){
+    uint8_t payload[FORMAT_DELTA_SIZE] = {0};
+
+    switch(host.step){
+        case HOST_UNLOCK:
+        case HOST_RESUME:
+            put32(&payload[0], IMAGE_BASE);
+            put32(&payload[4], imageLength);
+            hostSend((host.step == HOST_UNLOCK) ? BL_CMD_UNLOCK : BL_CMD_RESUME, 0, payload, 8);
+            break;
+
+        case HOST_WINDOW:
+            payload[0] = cfg.window;
+            hostSend(BL_CMD_WINDOW, 0, payload, 1);
+            hostTimerStart(cfg.timeout);
+            return;
+
+        case HOST_FORMAT:
+            payload[0] = cfg.format;
+            if(cfg.format == FORMAT_DELTA){
+                put32(&payload[4], baseRelease);
+                put32(&payload[8], baseCrc);
+            }
+            hostSend(BL_CMD_FORMAT, 0, payload, (cfg.format == FORMAT_DELTA) ? FORMAT_DELTA_SIZE : 1);
+            break;
+
+        case HOST_VERIFY:
+            put32(&payload[0], imageCrc);
+            hostSend(BL_CMD_VERIFY, 0, payload, CRC_SIZE);
+            break;
+
+        default:
+            return;
+    }
+    hostTimerStart(HOST_CMD_TIMEOUT);
+}
+
+/// Polls the cumulative ack of the window
+static void hostWindowPoll(void){
+    uint8_t window = cfg.window;
+
+    hostSend(BL_CMD_WINDOW, 0, &window, 1);
+    host.polling = true;
+    host.pollEnd = busFreeAt;
+    stats.polls++;
+}
+
+/// Sends the data frames allowed by the window and polls the ack after the last one
+static void hostWindowFill(void){
+    while((host.next < host.chunks) && (host.next - host.base < cfg.window)){
+        hostSendChunk(host.next++);
+    }
+
+    if((host.next == host.chunks) && (host.base < host.chunks) && !host.polling) hostWindowPoll();
+    hostTimerStart(cfg.timeout);
+}
+
+/// Moves to the given step and sends its first frame
+static void hostStep(HOST_STEP_t step){
+    host.step = step;
+    host.retries = 0;
+
+    if(step == HOST_DATA){
+        host.chunks = (streamLength - host.offset + MAX_DATA_SIZE - 1) / MAX_DATA_SIZE;
+        host.base = host.next = 0;
+        host.answers = 0;
+        host.polling = false;
+        if(host.chunks == 0){
+            hostStep(HOST_VERIFY);
+            return;
+        }
+        if(cfg.window) hostWindowFill();
+        else{
+            hostSendChunk(0);
+            hostTimerStart(cfg.timeout);
+        }
+        return;
+    }
+    hostCommand();
+}
+
+/// Step after UNLOCK or RESUME
+static void hostSessionStart(void){
+    if(cfg.window) hostStep(HOST_WINDOW);
+    else if((cfg.format != FORMAT_RAW) && (host.offset == 0)) hostStep(HOST_FORMAT);
+    else hostStep(HOST_DATA);
+}
+
+/// Power loss of the device when the given share of the stream is acked (see runUpdate())
+static bool hostPowerLossCheck(void){
+    if((cfg.resume == 0) || host.powerLoss) return false;
+    if(host.offset + host.base * MAX_DATA_SIZE < cfg.resume * streamLength) return false;
+
+    host.powerLoss = true;
+    powerLossPending = true;
+    host.gen++;
+    return true;
+}
+
+static void hostPowerOn(void){
+    deviceOn = true;
+    hostStep(HOST_RESUME);
+}
+
+/// Updates the first frame not acked with a window response (8 bit sequence)
+static void hostWindowAck(uint8_t seq){
+    uint8_t delta = (uint8_t) (seq - (uint8_t) host.base);
+
+    if(delta <= host.next - host.base) host.base += delta;
+}
+
+/**
+ * Data frame response in stop-and-wait mode.
+ *
+ * A frame repeated after a late answer (timeout shorter than a block patch)
+ * is answered SEQ_ERROR after the next frame has been sent: the answer is ignored
+ * while the answers expected are more than the frames waiting for the ack.
+ */
+static void hostDataResponse(uint8_t response){
+    if(host.answers > 0) host.answers--;
+
+    if(response == BL_RESP_SEQ_ERROR){
+        if(host.retries == 0){
+            if(host.answers > 0) return;
+            hostFail("sequence error");
+            return;
+        }
+        // Repeated frame already received: the answer was lost
+        stats.acksLost++;
+    }else if(response != BL_RESP_OK) return;
+
+    host.base++;
+    host.retries = 0;
+    if(hostPowerLossCheck()) return;
+
+    if(host.base == host.chunks) hostStep(HOST_VERIFY);
+    else{
+        hostSendChunk(host.base);
+        hostTimerStart(cfg.timeout);
+    }
+}
+
+/**
+ * Data frame response in sliding window mode.
+ *
+ * The ACKs of the device and of a WINDOW poll can't be told apart:
+ * an ACK is taken as the poll answer only after the end of the poll frame.
+ */
+static void hostWindowResponse(const MOCK_CAN_FRAME_t* frame){
+    uint8_t response = frame->data[0];
+
+    if(response == BL_RESP_ACK){
+        hostWindowAck(frame->data[1]);
+        if(host.polling && (simNow > host.pollEnd)){
+            // Answer of the poll: the first missing frame is repeated
+            host.polling = false;
+            if(host.base < host.next){
+                hostSendChunk(host.base);
+                stats.retries++;
+            }
+        }
+    }else if(response == BL_RESP_NACK){
+        hostWindowAck(frame->data[1]);
+        stats.nacks++;
+        if(host.base < host.next){
+            hostSendChunk(host.base);
+            stats.retries++;
+        }
+    }else return;
+
+    host.retries = 0;
+    if(hostPowerLossCheck()) return;
+
+    if(host.base == host.chunks) hostStep(HOST_VERIFY);
+    else hostWindowFill();
+}
+
+static void hostReceive(const MOCK_CAN_FRAME_t* frame){
+    uint8_t response = frame->data[0];
+
+    switch(host.step){
+        case HOST_UNLOCK:
+            if(response == BL_RESP_OK){
+                host.offset = 0;
+                hostSessionStart();
+            }else if(response == BL_RESP_ERROR) hostFail("UNLOCK refused");
+            break;
+
+        case HOST_RESUME:
+            if(response == BL_RESP_RESUME){
+                uint32_t addr = frame->data[1] | ((uint32_t) frame->data[2] << 8) |
+                                ((uint32_t) frame->data[3] << 16) | ((uint32_t) frame->data[4] << 24);
+                stats.resumeAddr = addr;
+                host.offset = addr - IMAGE_BASE;
+                hostSessionStart();
+            }else if(response == BL_RESP_ERROR){
+                // No journal: the transfer restarts
+                hostStep(HOST_UNLOCK);
+            }
+            break;
+
+        case HOST_WINDOW:
+            if(response == BL_RESP_ACK){
+                if((cfg.format != FORMAT_RAW) && (host.offset == 0)) hostStep(HOST_FORMAT);
+                else hostStep(HOST_DATA);
+            }else if(response == BL_RESP_ERROR) hostFail("WINDOW refused");
+            break;
+
+        case HOST_FORMAT:
+            if(response == BL_RESP_OK) hostStep(HOST_DATA);
+            else if(response == BL_RESP_CRC_FAIL) hostFail("delta base mismatch");
+            else if(response == BL_RESP_ERROR) hostFail("FORMAT refused");
+            break;
+
+        case HOST_DATA:
+            if((response == BL_RESP_ERROR) || (response == BL_RESP_INVALID)) hostFail("DATA refused");
+            else if(cfg.window == 0) hostDataResponse(response);
+            else hostWindowResponse(frame);
+            break;
+
+        case HOST_VERIFY:
+            if(response == BL_RESP_CRC_OK){
+                host.step = HOST_DONE;
+                host.end = simNow;
+                host.gen++;
+            }else if(response == BL_RESP_CRC_FAIL) hostFail("CRC mismatch");
+            break;
+
+        default:
+            break;
+    }
+}
+
+static void hostTimeout(void){
+    stats.timeouts++;
+    if(++host.retries > HOST_RETRIES){
+        hostFail("no response");
+        return;
+    }
+    stats.retries++;
+
+    if(host.step != HOST_DATA) hostCommand();
+    else if(cfg.window == 0){
+        hostSendChunk(host.base);
+        hostTimerStart(cfg.timeout);
+    }else{
+        // Window mode: poll the cumulative ack
+        hostWindowPoll();
+        hostTimerStart(cfg.timeout);
+    }
+}
+
+// Image and stream encoders
+
+/// Synthetic firmware-like image: random code with repeated fragments and constant tables
+static void imageSynthesize(uint8_t* dst, uint32_t length){
+    uint32_t i = 0;
+
+    while(i < length){
+        uint32_t kind = random32() % 16;
+        uint32_t run = 4 + random32() % 60;
+        if(run > length - i) run = length - i;
+
+        if((kind < 7) && (i > 64)){
+            // Repeated fragment (instruction sequences, literal pools)
+            uint32_t distance = 1 + random32() % ((i < 4096) ? i : 4096);
+            for(uint32_t k = 0; k < run; k++, i++) dst[i] = dst[i - distance];
+        }else if(kind < 8){
+            uint8_t value = (random32() & 1) ? 0x00 : 0xFF;
+            for(uint32_t k = 0; k < run; k++, i++) dst[i] = value;
+        }else{
+            for(uint32_t k = 0; k < run; k++, i++) dst[i] = (uint8_t) random32();
+        }
+    }
+}
+
+static uint32_t lz4Length(uint8_t* dst, uint32_t pos, uint32_t length){
+    while(length >= 255){
+        dst[pos++] = 255;
+        length -= 255;
+    }
+    dst[pos++] = (uint8_t) length;
+    return pos;
+}
+
+static uint32_t lz4Sequence(uint8_t* dst, uint32_t pos, const uint8_t* literals, uint32_t literalLength,
+                            uint32_t offset, uint32_t matchLength){
+    uint32_t token = pos++;
+    uint32_t ml = (matchLength) ? matchLength - 4 : 0;
+
+    dst[token] = (uint8_t) (((literalLength < 15) ? literalLength : 15) << 4);
+    if(literalLength >= 15) pos = lz4Length(dst, pos, literalLength - 15);
+    memcpy(&dst[pos], literals, literalLength);
+    pos += literalLength;
+    if(matchLength == 0) return pos;
+
+    dst[token] |= (uint8_t) ((ml < 15) ? ml : 15);
+    dst[pos++] = (uint8_t) offset;
+    dst[pos++] = (uint8_t) (offset >> 8);
+    if(ml >= 15) pos = lz4Length(dst, pos, ml - 15);
+    return pos;
+}
+
+/// Greedy LZ4 block compressor (hash of 4 bytes, 64KB window)
+static uint32_t lz4Compress(const uint8_t* src, uint32_t length, uint8_t* dst){
+    static int32_t table[1 << 14];
+    uint32_t anchor = 0;
+    uint32_t i = 0;
+    uint32_t pos = 0;
+
+    for(unsigned k = 0; k < sizeof(table) / sizeof(table[0]); k++) table[k] = -1;
+
+    while(i + 4 <= length){
+        uint32_t word;
+        memcpy(&word, &src[i], 4);
+        uint32_t h = (word * 2654435761U) >> 18;
+        int32_t ref = table[h];
+        table[h] = (int32_t) i;
+
+        if((ref >= 0) && (i - ref <= 0xFFFF) && (memcmp(&src[ref], &src[i], 4) == 0)){
+            uint32_t ml = 4;
+            while((i + ml < length) && (src[ref + ml] == src[i + ml])) ml++;
+
+            pos = lz4Sequence(dst, pos, &src[anchor], i - anchor, i - ref, ml);
+            i += ml;
+            anchor = i;
+        }else i++;
+    }
+
+    if(anchor < length) pos = lz4Sequence(dst, pos, &src[anchor], length - anchor, 0, 0);
+    return pos;
+}
+
+static uint32_t deltaRecord(uint8_t* dst, uint32_t pos, uint8_t record, const uint8_t* data, uint32_t length){
+    dst[pos++] = record;
+    dst[pos++] = (uint8_t) length;
+    dst[pos++] = (uint8_t) (length >> 8);
+    if(data){
+        memcpy(&dst[pos], data, length);
+        pos += length;
+    }
+    return pos;
+}
+
+/// Delta stream: unchanged blocks are skipped, the changed blocks are patched
+static uint32_t deltaEncode(const uint8_t* base, const uint8_t* src, uint32_t length, uint8_t* dst){
+    uint32_t pos = 0;
+    uint32_t skip = 0;
+
+    for(uint32_t start = 0; start < length; start += ERASE_BLOCK_SIZE){
+        uint32_t end = (start + ERASE_BLOCK_SIZE < length) ? start + ERASE_BLOCK_SIZE : length;
+
+        if((end - start == ERASE_BLOCK_SIZE) && (memcmp(&base[start], &src[start], ERASE_BLOCK_SIZE) == 0)){
+            skip++;
+            if(skip == 255){
+                dst[pos++] = DELTA_BLOCK_SKIP;
+                dst[pos++] = 255;
+                skip = 0;
+            }
+            continue;
+        }
+
+        if(skip){
+            dst[pos++] = DELTA_BLOCK_SKIP;
+            dst[pos++] = (uint8_t) skip;
+            skip = 0;
+        }
+        dst[pos++] = DELTA_BLOCK_PATCH;
+
+        uint32_t i = start;
+        while(i < end){
+            // Unchanged run: copied if at least 4 bytes or up to the block end
+            uint32_t j = i;
+            while((j < end) && (base[j] == src[j])) j++;
+            if((j > i) && ((j - i >= 4) || (j == end))){
+                pos = deltaRecord(dst, pos, DELTA_COPY, NULL, j - i);
+                i = j;
+                continue;
+            }
+
+            // New bytes up to the next unchanged run
+            j = i;
+            while(j < end){
+                uint32_t k = j;
+                while((k < end) && (base[k] == src[k])) k++;
+                if((k > j) && ((k - j >= 4) || (k == end))) break;
+                j = (k > j) ? k : j + 1;
+            }
+            pos = deltaRecord(dst, pos, DELTA_DATA, &src[i], j - i);
+            i = j;
+        }
+    }
+    // The unchanged blocks at the end are not sent: VERIFY reads them from the flash
+    return pos;
+}
+
+static uint32_t fileRead(const char* name, uint8_t* dst){
+    FILE* f = fopen(name, "rb");
+    if(!f){
+        perror(name);
+        exit(1);
+    }
+
+    uint32_t length = (uint32_t) fread(dst, 1, IMAGE_MAX, f);
+    if(!feof(f)){
+        fprintf(stderr, "%s: image larger than %u bytes\n", name, (unsigned) IMAGE_MAX);
+        exit(1);
+    }
+    fclose(f);
+    return length;
+}
+
+// Run
+
+static void runReset(void){
+    simNow = 0;
+    eventCount = 0;
+    busFreeAt = 0;
+    deviceOn = true;
+    powerLossPending = false;
+    rng = cfg.seed * 2654435761U + 1;
+    memset(&stats, 0, sizeof(stats));
+    memset(&host, 0, sizeof(host));
+
+    mockNvmReset();
+    mockCan.overflows = 0;
+    deviceReset();
+
+    // Installed content: bootloader, base image, blank journal
+    for(uint32_t i = 0; i < IMAGE_BASE; i++) mockFlash[i] = (uint8_t) (i * 0x45);
+    memset(&mockFlash[IMAGE_BASE], 0xFF, MOCK_FLASH_SIZE - IMAGE_BASE);
+    memcpy(&mockFlash[IMAGE_BASE], baseImage, imageLength);
+}
+
+/**
+ * Runs an update: the bootloader loop runs until the host
+ * completes or fails.
+ */
+static bool runUpdate(void){
+    runReset();
+    hostStep(HOST_UNLOCK);
+
+    while((host.step != HOST_DONE) && (host.step != HOST_FAILED)){
+        if(simNow > SIM_LIMIT){
+            hostFail("simulation time limit");
+            break;
+        }
+        mockAdvance(SIM_LOOP_TIME);
+        if(deviceOn) _task();
+
+        // The power loss is applied between two bootloader loop iterations
+        if(powerLossPending){
+            powerLossPending = false;
+            mockNvmPowerLoss();
+            deviceReset();
+            deviceOn = false;
+
+            // The frames in flight are lost
+            eventCount = 0;
+            eventAdd(simNow + SIM_BOOT_TIME, EV_POWER_ON, 0, NULL);
+        }
+    }
+
+    return (host.step == HOST_DONE) && (memcmp(&mockFlash[IMAGE_BASE], image, imageLength) == 0);
+}
+
+static void runReport(void){
+    double seconds = host.end / 1e6;
+
+    printf("result: %s", (host.step == HOST_DONE) ? "CRC_OK" : host.error);
+    printf(", flash content %s\n", (memcmp(&mockFlash[IMAGE_BASE], image, imageLength) == 0) ? "matches" : "MISMATCH");
+    if(cfg.resume) printf("power loss at %.0f%%, resumed at 0x%05X\n", cfg.resume * 100, stats.resumeAddr);
+    printf("time: %.3f s, throughput %.1f KB/s\n", seconds, (seconds > 0) ? imageLength / 1024.0 / seconds : 0);
+    printf("bus: utilisation %.1f%%, host frames %u, device frames %u, lost %u\n",
+           (host.end > 0) ? 100.0 * stats.busBusy / host.end : 0, stats.hostFrames, stats.deviceFrames, stats.lost);
+    printf("host: retries %u, timeouts %u, polls %u, nacks %u, lost acks %u, RX FIFO overflows %u\n",
+           stats.retries, stats.timeouts, stats.polls, stats.nacks, stats.acksLost, mockCan.overflows);
+    printf("nvm: erases %u, page writes %u, quad writes %u, busy %.3f s, CPU stall %.3f s, program errors %u\n",
+           mockNvm.blockErases, mockNvm.pageWrites, mockNvm.quadWrites, mockNvm.busyTime / 1e6,
+           mockNvm.stallTime / 1e6, mockNvm.programErrors);
+}
+
+/**
+ * Full window test: after UNLOCK and WINDOW, WINDOW_MAX data frames are queued
+ * in the RX FIFO0 before a single _task() call (the device was busy).
+ * RF0N is set once, so the task must read the FIFO until it is empty.
+ */
+static bool runWindowTest(void){
+    MOCK_CAN_FRAME_t frame;
+    uint8_t payload[OFFSET_SIZE + SIZE_SIZE];
+    uint8_t depth = mockCan.depth;
+    bool ok;
+
+    runReset();
+    mockCan.depth = WINDOW_MAX;
+
+    put32(&payload[0], IMAGE_BASE);
+    put32(&payload[4], imageLength);
+    hostFrame(&frame, BL_CMD_UNLOCK, 0, payload, OFFSET_SIZE + SIZE_SIZE);
+    mockCanDeliver(&frame);
+    _task();
+
+    payload[0] = WINDOW_MAX;
+    hostFrame(&frame, BL_CMD_WINDOW, 0, payload, 1);
+    mockCanDeliver(&frame);
+    _task();
+
+    for(uint8_t seq = 0; seq < WINDOW_MAX; seq++){
+        hostFrame(&frame, BL_CMD_DATA, seq, &image[seq * MAX_DATA_SIZE], MAX_DATA_SIZE);
+        mockCanDeliver(&frame);
+    }
+    _task();
+
+    ok = (mockCan.level == 0) && (data_seq == WINDOW_MAX) && !mockCan.overflows;
+    printf("window test: %u frames queued, %u stored, %u left in the RX FIFO0: %s\n",
+           WINDOW_MAX, data_seq, mockCan.level, (ok) ? "ok" : "FAILED");
+
+    mockCan.depth = depth;
+    return ok;
+}
+
+/// Retry sensitivity: the update is repeated for a set of frame loss rates
+static void runSweep(void){
+    static const double losses[] = {0, 0.001, 0.002, 0.005, 0.01, 0.02, 0.05};
+
+    printf("\n  loss    time(s)   KB/s  retries timeouts overflows result\n");
+    for(unsigned i = 0; i < sizeof(losses) / sizeof(losses[0]); i++){
+        cfg.loss = losses[i];
+        bool ok = runUpdate();
+        double seconds = host.end / 1e6;
+        printf("%5.1f%% %9.3f %7.1f %8u %8u %9u %s\n", losses[i] * 100, seconds,
+               (seconds > 0) ? imageLength / 1024.0 / seconds : 0, stats.retries, stats.timeouts,
+               mockCan.overflows, ok ? "ok" : ((host.step == HOST_DONE) ? "MISMATCH" : host.error));
+    }
+}
+
+static void usage(void){
+    fprintf(stderr,
+            "usage: bl_emulator [-S KB] [-i image.bin] [-b base.bin] [-f raw|lz4|delta] [-p changed%%]\n"
+            "                   [-w window] [-n nominal_kbps] [-d data_kbps] [-m fd|brs] [-l loss%%]\n"
+            "                   [-L latency_us] [-T timeout_ms] [-q fifo] [-E erase_ms] [-P page_ms]\n"
+            "                   [-Q quad_us] [-c] [-r resume%%] [-s seed] [-x] [-t]\n");
+    exit(1);
+}
+
+int main(int argc, char** argv){
+    const char* imageFile = NULL;
+    const char* baseFile = NULL;
+    uint32_t sizeKB = 256;
+    double changed = 10;
+    bool sweep = false;
+    bool windowTest = false;
+    bool ok = true;
+    int opt;
+
+    cfg.nominal = 500000;
+    cfg.data = 2000000;
+    cfg.brs = true;
+    cfg.latency = 200;
+    cfg.timeout = 50000;
+    cfg.seed = 1;
+    mockCan.depth = 8;
+    mockNvm.tBlockErase = 12000;
+    mockNvm.tPageWrite = 2500;
+    mockNvm.tQuadWrite = 100;
+    mockNvm.fetchStall = true;
+
+    while((opt = getopt(argc, argv, "S:i:b:f:p:w:n:d:m:l:L:T:q:E:P:Q:cr:s:xt")) != -1){
+        switch(opt){
+            case 'S': sizeKB = (uint32_t) atoi(optarg); break;
+            case 'i': imageFile = optarg; break;
+            case 'b': baseFile = optarg; break;
+            case 'f':
+                if(strcmp(optarg, "raw") == 0) cfg.format = FORMAT_RAW;
+                else if(strcmp(optarg, "lz4") == 0) cfg.format = FORMAT_LZ4;
+                else if(strcmp(optarg, "delta") == 0) cfg.format = FORMAT_DELTA;
+                else usage();
+                break;
+            case 'p': changed = atof(optarg); break;
+            case 'w': cfg.window = (uint8_t) atoi(optarg); break;
+            case 'n': cfg.nominal = (uint32_t) (atof(optarg) * 1000); break;
+            case 'd': cfg.data = (uint32_t) (atof(optarg) * 1000); break;
+            case 'm':
+                if(strcmp(optarg, "fd") == 0) cfg.brs = false;
+                else if(strcmp(optarg, "brs") == 0) cfg.brs = true;
+                else usage();
+                break;
+            case 'l': cfg.loss = atof(optarg) / 100; break;
+            case 'L': cfg.latency = atof(optarg); break;
+            case 'T': cfg.timeout = atof(optarg) * 1000; break;
+            case 'q': mockCan.depth = (uint8_t) atoi(optarg); break;
+            case 'E': mockNvm.tBlockErase = atof(optarg) * 1000; break;
+            case 'P': mockNvm.tPageWrite = atof(optarg) * 1000; break;
+            case 'Q': mockNvm.tQuadWrite = atof(optarg); break;
+            case 'c': mockNvm.fetchStall = false; break;
+            case 'r': cfg.resume = atof(optarg) / 100; break;
+            case 's': cfg.seed = (uint32_t) atoi(optarg); break;
+            case 'x': sweep = true; break;
+            case 't': windowTest = true; break;
+            default: usage();
+        }
+    }
+
+    if((cfg.window > WINDOW_MAX) || (mockCan.depth == 0) || (mockCan.depth > MOCK_RX_FIFO_MAX) ||
+       (cfg.nominal == 0) || (cfg.data == 0) || (cfg.resume >= 1)) usage();
+
+    // New image and installed image (padded with the erased value to the page size)
+    rng = cfg.seed;
+    memset(image, 0xFF, sizeof(image));
+    memset(baseImage, 0xFF, sizeof(baseImage));
+
+    if(imageFile) imageLength = fileRead(imageFile, image);
+    else{
+        imageLength = sizeKB * 1024;
+        if((imageLength == 0) || (imageLength > IMAGE_MAX)) usage();
+        imageSynthesize(image, imageLength);
+    }
+    imageLength = (imageLength + PAGE_SIZE - 1) & SIZE_ALIGN_MASK;
+    if(imageLength > IMAGE_MAX){
+        fprintf(stderr, "image larger than %u bytes\n", (unsigned) IMAGE_MAX);
+        return 1;
+    }
+
+    if(baseFile){
+        if(fileRead(baseFile, baseImage) > imageLength){
+            fprintf(stderr, "%s: base larger than the image\n", baseFile);
+            return 1;
+        }
+    }else{
+        // The new image changes a share of the blocks of the installed one
+        memcpy(baseImage, image, imageLength);
+        for(uint32_t start = 0; start < imageLength; start += ERASE_BLOCK_SIZE){
+            if((random32() % 1000) >= changed * 10) continue;
+            uint32_t at = start + random32() % ERASE_BLOCK_SIZE;
+            for(uint32_t k = 0; (k < 64) && (at + k < imageLength); k++) baseImage[at + k] ^= (uint8_t) (random32() | 1);
+        }
+    }
+
+    imageCrc = hostCrc(image, imageLength);
+    baseCrc = hostCrc(baseImage, imageLength);
+    memcpy(&baseRelease, &baseImage[_MET_BOOTLOADER_APP_RELEASE_OFFSET - IMAGE_BASE], 4);
+
+    if(cfg.format == FORMAT_LZ4) streamLength = lz4Compress(image, imageLength, stream);
+    else if(cfg.format == FORMAT_DELTA) streamLength = deltaEncode(baseImage, image, imageLength, stream);
+    else{
+        memcpy(stream, image, imageLength);
+        streamLength = imageLength;
+    }
+
+    printf("image: %u bytes, %s stream %u bytes (%u frames)\n", imageLength,
+           (cfg.format == FORMAT_LZ4) ? "LZ4" : ((cfg.format == FORMAT_DELTA) ? "delta" : "raw"),
+           streamLength, (streamLength + MAX_DATA_SIZE - 1) / MAX_DATA_SIZE);
+    printf("link: CAN FD %u/%u kbit/s%s, loss %.2f%%, host latency %.0f us, timeout %.0f ms, RX FIFO %u\n",
+           cfg.nominal / 1000, (cfg.brs) ? cfg.data / 1000 : cfg.nominal / 1000, (cfg.brs) ? " BRS" : "",
+           cfg.loss * 100, cfg.latency, cfg.timeout / 1000, mockCan.depth);
+    printf("host: %s", (cfg.window) ? "sliding window " : "stop-and-wait");
+    if(cfg.window) printf("%u", cfg.window);
+    printf(", nvm: erase %.1f ms, page %.2f ms, quad %.0f us, %s\n", mockNvm.tBlockErase / 1000,
+           mockNvm.tPageWrite / 1000, mockNvm.tQuadWrite, (mockNvm.fetchStall) ? "fetch stall" : "cached");
+
+    if(windowTest) ok = runWindowTest();
+
+    ok = runUpdate() && ok;
+    runReport();
+
+    if(sweep) runSweep();
+    return (ok) ? 0 : 1;
+}
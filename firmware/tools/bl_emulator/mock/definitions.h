@@ -0,0 +1,195 @@
+/*
+ * Host replacement of the Harmony 3 definitions.h of the bootloader (config/my_config)
+ *
+ * Only the objects used by bootloader/bootloader.c are declared:
+ * - NVMCTRL: a 1MB flash array with the erase and programming timings
+ *   (the flash content is read through FLASH_PTR());
+ * - DMAC CRC engine (I/O mode), DSU CRC and PAC;
+ * - the CAN placeholders of the bootloader template, connected to the
+ *   virtual CAN link of the emulator (RX FIFO0 and transmission),
+ *   and the RX FIFO0 fill level (RX_FIFO0_LEVEL());
+ * - the CMSIS functions of the application jump (never called).
+ *
+ * The simulation state is exported so the emulator can drive the link
+ * and collect the statistics.
+ */
+#ifndef _MOCK_DEFINITIONS_H
+#define _MOCK_DEFINITIONS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define CACHE_ALIGN     __attribute__((aligned(32)))
+#define __WEAK          __attribute__((weak))
+
+// Flash
+#define MOCK_FLASH_SIZE         0x100000U
+#define MOCK_BANK_SIZE          0x80000U
+#define NVMCTRL_FLASH_PAGESIZE  512U
+#define NVMCTRL_FLASH_BLOCKSIZE 8192U
+
+extern uint8_t mockFlash[MOCK_FLASH_SIZE];
+
+#define FLASH_PTR(addr) (&mockFlash[(uint32_t)(addr) & (MOCK_FLASH_SIZE - 1)])
+
+// NVMCTRL
+#define NVMCTRL_INTFLAG_ADDRE_Msk   0x0002U
+#define NVMCTRL_INTFLAG_PROGE_Msk   0x0004U
+#define NVMCTRL_INTFLAG_LOCKE_Msk   0x0008U
+#define NVMCTRL_INTFLAG_NVME_Msk    0x0020U
+
+/// NVM timings (us) and statistics
+typedef struct{
+    double tPageWrite;          //!< Page write time
+    double tQuadWrite;          //!< Quad word write time
+    double tBlockErase;         //!< Block erase time
+    bool   fetchStall;          //!< The CPU (executing from the bank A) is stalled during a bank A operation
+
+    uint32_t pageWrites;
+    uint32_t quadWrites;
+    uint32_t blockErases;
+    uint32_t programErrors;     //!< Quad words programmed twice without erase
+    double   busyTime;          //!< Total NVM busy time (us)
+    double   stallTime;         //!< Total CPU stall time (us)
+}MOCK_NVM_t;
+
+extern MOCK_NVM_t mockNvm;
+
+void mockNvmReset(void);
+void mockNvmPowerLoss(void);
+
+bool NVMCTRL_PageWrite(const uint32_t* data, const uint32_t address);
+bool NVMCTRL_QuadWordWrite(const uint32_t* data, const uint32_t address);
+bool NVMCTRL_BlockErase(uint32_t address);
+bool NVMCTRL_IsBusy(void);
+uint16_t NVMCTRL_ErrorGet(void);
+void NVMCTRL_RegionUnlock(uint32_t address);
+
+// DMAC CRC engine (I/O interface)
+typedef enum{
+    DMAC_CRC_TYPE_16 = 0,
+    DMAC_CRC_TYPE_32 = 1,
+}DMAC_CRC_POLYNOMIAL_TYPE;
+
+typedef enum{
+    DMAC_CRC_MODE_DEFAULT = 0,
+}DMAC_CRC_MODE;
+
+typedef struct{
+    DMAC_CRC_POLYNOMIAL_TYPE polynomial_type;
+    DMAC_CRC_MODE crc_mode;
+    uint32_t seed;
+}DMAC_CRC_SETUP;
+
+/*
+ * The bootloader feeds the engine writing CRCDATAIN and polling CRCSTATUS.
+ * The register names are mapped to arrays indexed by the mock functions:
+ * a CRCDATAIN write marks a word pending, the next CRCSTATUS access feeds it.
+ */
+typedef struct{
+    uint32_t crcDataIn[1];
+    uint32_t crcStatus[1];
+}dmac_registers_t;
+
+extern dmac_registers_t mockDmacRegs;
+
+int mockCrcDataIn(void);
+int mockCrcStatus(void);
+
+#define DMAC_REGS                       (&mockDmacRegs)
+#define DMAC_CRCDATAIN                  crcDataIn[mockCrcDataIn()]
+#define DMAC_CRCSTATUS                  crcStatus[mockCrcStatus()]
+#define DMAC_CRCSTATUS_CRCBUSY_Msk      0x01U
+
+uint32_t DMAC_CRCCalculate(void* buffer, uint32_t length, DMAC_CRC_SETUP CRCSetup);
+uint32_t DMAC_CRCRead(void);
+
+// DSU and PAC
+typedef enum{
+    PAC_PERIPHERAL_DSU = 0,
+}PAC_PERIPHERAL;
+
+typedef enum{
+    PAC_PROTECTION_CLEAR = 1,
+    PAC_PROTECTION_SET = 2,
+}PAC_PROTECTION;
+
+void PAC_PeripheralProtectSetup(PAC_PERIPHERAL peripheral, PAC_PROTECTION operation);
+bool DSU_CRCCalculate(uint32_t addr, uint32_t length, uint32_t seed, uint32_t* crc);
+
+// CAN (bootloader template placeholders)
+#define MOCK_CAN_MAX_DATA       64
+#define MOCK_RX_FIFO_MAX        64
+
+#define _MESSAGE_RAM_CONFIG_SIZE        1024
+#define _INTERRUPT_RF0N_MASK            0x00000001U
+#define _INTERRUPT_TFE_MASK             0x00000200U
+#define _PSR_LEC_Msk                    0x00000007U
+#define _ERROR_NONE                     0x0U
+#define _ERROR_LEC_NO_CHANGE            0x7U
+
+typedef enum{
+    _MODE_NORMAL = 0,
+    _MODE_FD_WITHOUT_BRS,
+    _MODE_FD_WITH_BRS,
+}MOCK_CAN_MODE;
+
+typedef enum{
+    _MSG_ATTR_TX_FIFO_DATA_FRAME = 0,
+}MOCK_CAN_TX_ATTRIBUTE;
+
+typedef enum{
+    _MSG_ATTR_RX_FIFO0 = 0,
+}MOCK_CAN_RX_ATTRIBUTE;
+
+typedef enum{
+    _MSG_RX_DATA_FRAME = 0,
+    _MSG_RX_REMOTE_FRAME,
+}_MSG_RX_FRAME_ATTRIBUTE;
+
+/// A CAN frame of the virtual link
+typedef struct{
+    uint32_t id;
+    uint8_t length;
+    uint8_t data[MOCK_CAN_MAX_DATA];
+}MOCK_CAN_FRAME_t;
+
+/// Device side of the virtual CAN link: RX FIFO0
+typedef struct{
+    MOCK_CAN_FRAME_t fifo[MOCK_RX_FIFO_MAX];
+    uint8_t depth;              //!< RX FIFO0 elements (F0S)
+    uint8_t get;
+    uint8_t level;
+    bool rf0n;                  //!< RX FIFO0 new message flag (IR.RF0N): set by a frame, cleared by _InterruptClear()
+    uint32_t overflows;         //!< Frames lost because the RX FIFO0 is full
+    double txIdleAt;            //!< End of the last transmission of the device (TFE)
+}MOCK_CAN_t;
+
+extern MOCK_CAN_t mockCan;
+
+#define RX_FIFO0_LEVEL() (mockCan.level)
+
+bool mockCanDeliver(const MOCK_CAN_FRAME_t* frame);
+
+bool _MessageTransmit(uint32_t id, uint8_t length, uint8_t* data, MOCK_CAN_MODE mode, MOCK_CAN_TX_ATTRIBUTE msgAttr);
+bool _MessageReceive(uint32_t* id, uint8_t* length, uint8_t* data, uint16_t timestamp,
+                     MOCK_CAN_RX_ATTRIBUTE msgAttr, _MSG_RX_FRAME_ATTRIBUTE* msgFrameAttr);
+void _MessageRAMConfigSet(uint8_t* msgRAMConfigBaseAddress);
+bool _InterruptGet(uint32_t interruptMask);
+void _InterruptClear(uint32_t interruptMask);
+uint32_t _ErrorGet(void);
+
+// Emulator hooks (emulator.c)
+void mockDeviceTransmit(const MOCK_CAN_FRAME_t* frame);
+void mockAdvance(double us);
+double mockNow(void);
+
+// CMSIS (application jump and reset: never called by the emulator)
+void NVIC_SystemReset(void);
+void __set_MSP(uint32_t topOfMainStack);
+
+#define asm(...)    ((void) 0)
+
+#endif
@@ -0,0 +1,5 @@
+/*
+ * Host replacement of the device header: the peripheral objects
+ * used by the bootloader are declared by the mock definitions.h
+ */
+#include "definitions.h"
@@ -0,0 +1,310 @@
+/*
+ * Host mocks of the peripherals used by the bootloader:
+ * NVMCTRL timing model, DMAC and DSU CRC engines, CAN RX FIFO0.
+ *
+ * The time is owned by the emulator (mockNow(), mockAdvance()):
+ * the mocks advance it for the NVM operations and the busy polling,
+ * so the link keeps delivering frames while the bootloader waits.
+ */
+#include "definitions.h"
+
+#define NVM_POLL_TIME       0.5     //!< Time (us) of a busy polling iteration
+#define CRC_WORD_TIME       0.02    //!< Time (us) of a DMAC CRC I/O beat
+#define DSU_WORD_TIME       0.035   //!< Time (us) of a DSU CRC word read
+#define RX_FRAME_TIME       3.0     //!< Time (us) to read a frame from the message RAM
+#define QUAD_SIZE           16
+
+uint8_t mockFlash[MOCK_FLASH_SIZE] __attribute__((aligned(16)));
+MOCK_NVM_t mockNvm;
+MOCK_CAN_t mockCan;
+dmac_registers_t mockDmacRegs;
+
+static double   nvmBusyUntil;       //!< End of the NVM operation in progress
+static uint32_t nvmOpAddress;       //!< Address of the last NVM operation
+static uint32_t nvmOpSize;          //!< Size of the last NVM operation (0 = erase)
+static uint16_t nvmErrors;          //!< INTFLAG error bits of the last operation
+
+static uint32_t crcRegister;        //!< DMAC CRC checksum (not complemented)
+static bool     crcPending;         //!< A CRCDATAIN word is waiting to be fed
+
+/**
+ * CRC-32 (IEEE 802.3, reflected) update without the final complement:
+ * this is the DSU checksum register.
+ */
+static uint32_t crc32Update(uint32_t crc, const uint8_t* data, uint32_t len){
+    for(uint32_t i = 0; i < len; i++){
+        crc ^= data[i];
+        for(int j = 0; j < 8; j++){
+            if(crc & 1) crc = (crc >> 1) ^ 0xEDB88320;
+            else crc = crc >> 1;
+        }
+    }
+    return crc;
+}
+
+// NVMCTRL
+
+void mockNvmReset(void){
+    double tPageWrite = mockNvm.tPageWrite;
+    double tQuadWrite = mockNvm.tQuadWrite;
+    double tBlockErase = mockNvm.tBlockErase;
+    bool fetchStall = mockNvm.fetchStall;
+
+    memset(&mockNvm, 0, sizeof(mockNvm));
+    mockNvm.tPageWrite = tPageWrite;
+    mockNvm.tQuadWrite = tQuadWrite;
+    mockNvm.tBlockErase = tBlockErase;
+    mockNvm.fetchStall = fetchStall;
+
+    nvmBusyUntil = 0;
+    nvmOpSize = 0;
+    nvmErrors = 0;
+}
+
+/**
+ * Power loss during the NVM operation in progress:
+ * the second half of the page or of the block is left as before the operation
+ * (a write is partially programmed, an erase leaves part of the old content).
+ */
+void mockNvmPowerLoss(void){
+    if(mockNow() >= nvmBusyUntil) return;
+
+    if(nvmOpSize) memset(&mockFlash[nvmOpAddress + nvmOpSize / 2], 0xFF, nvmOpSize / 2);
+    else{
+        for(uint32_t i = NVMCTRL_FLASH_BLOCKSIZE / 2; i < NVMCTRL_FLASH_BLOCKSIZE; i++){
+            mockFlash[nvmOpAddress + i] = (uint8_t) (i * 0x9E);
+        }
+    }
+    nvmBusyUntil = 0;
+}
+
+/**
+ * Starts an NVM operation of the given duration.
+ *
+ * The NVMCTRL can't read a bank while it is written: the CPU executing
+ * the bootloader from the bank A is stalled until the end of a bank A operation.
+ */
+static void nvmStart(uint32_t address, uint32_t size, double duration){
+    // A command issued while busy is queued by the bus wait states
+    if(mockNow() < nvmBusyUntil) mockAdvance(nvmBusyUntil - mockNow());
+
+    nvmOpAddress = address;
+    nvmOpSize = size;
+    nvmBusyUntil = mockNow() + duration;
+    mockNvm.busyTime += duration;
+
+    if(mockNvm.fetchStall && (address < MOCK_BANK_SIZE)){
+        mockNvm.stallTime += duration;
+        mockAdvance(duration);
+    }
+}
+
+/**
+ * Programs the flash: the bits can only be cleared,
+ * and a quad word (ECC unit) can be programmed only once after the erase.
+ */
+static bool nvmProgram(const uint32_t* data, uint32_t address, uint32_t size){
+    const uint8_t* src = (const uint8_t*) data;
+
+    nvmErrors = 0;
+    if((address % size) || (address >= MOCK_FLASH_SIZE)){
+        nvmErrors = NVMCTRL_INTFLAG_ADDRE_Msk;
+        return false;
+    }
+
+    for(uint32_t q = 0; q < size; q += QUAD_SIZE){
+        bool programmed = false;
+        bool blank = true;
+        for(uint32_t i = q; i < q + QUAD_SIZE; i++){
+            if(mockFlash[address + i] != 0xFF) programmed = true;
+            if(src[i] != 0xFF) blank = false;
+        }
+        if(programmed && !blank){
+            nvmErrors |= NVMCTRL_INTFLAG_PROGE_Msk;
+            mockNvm.programErrors++;
+        }
+        for(uint32_t i = q; i < q + QUAD_SIZE; i++) mockFlash[address + i] &= src[i];
+    }
+    return true;
+}
+
+bool NVMCTRL_PageWrite(const uint32_t* data, const uint32_t address){
+    if(mockNow() < nvmBusyUntil) mockAdvance(nvmBusyUntil - mockNow());
+    if(!nvmProgram(data, address, NVMCTRL_FLASH_PAGESIZE)) return false;
+
+    mockNvm.pageWrites++;
+    nvmStart(address, NVMCTRL_FLASH_PAGESIZE, mockNvm.tPageWrite);
+    return true;
+}
+
+bool NVMCTRL_QuadWordWrite(const uint32_t* data, const uint32_t address){
+    if(mockNow() < nvmBusyUntil) mockAdvance(nvmBusyUntil - mockNow());
+    if(!nvmProgram(data, address, QUAD_SIZE)) return false;
+
+    mockNvm.quadWrites++;
+    nvmStart(address, QUAD_SIZE, mockNvm.tQuadWrite);
+    return true;
+}
+
+bool NVMCTRL_BlockErase(uint32_t address){
+    if(mockNow() < nvmBusyUntil) mockAdvance(nvmBusyUntil - mockNow());
+
+    nvmErrors = 0;
+    if(address >= MOCK_FLASH_SIZE){
+        nvmErrors = NVMCTRL_INTFLAG_ADDRE_Msk;
+        return false;
+    }
+
+    address &= ~(NVMCTRL_FLASH_BLOCKSIZE - 1);
+    memset(&mockFlash[address], 0xFF, NVMCTRL_FLASH_BLOCKSIZE);
+
+    mockNvm.blockErases++;
+    nvmStart(address, 0, mockNvm.tBlockErase);
+    return true;
+}
+
+bool NVMCTRL_IsBusy(void){
+    if(mockNow() >= nvmBusyUntil) return false;
+
+    mockAdvance(NVM_POLL_TIME);
+    return true;
+}
+
+uint16_t NVMCTRL_ErrorGet(void){
+    return nvmErrors;
+}
+
+void NVMCTRL_RegionUnlock(uint32_t address){
+    (void) address;
+}
+
+// DMAC CRC engine: the words are fed LSB first (reflected CRC-32)
+
+static void crcFeed(void){
+    if(!crcPending) return;
+
+    crcPending = false;
+    crcRegister = crc32Update(crcRegister, (const uint8_t*) &mockDmacRegs.crcDataIn[0], 4);
+    mockDmacRegs.crcStatus[0] = DMAC_CRCSTATUS_CRCBUSY_Msk;
+    mockAdvance(CRC_WORD_TIME);
+}
+
+int mockCrcDataIn(void){
+    crcFeed();
+    crcPending = true;
+    return 0;
+}
+
+int mockCrcStatus(void){
+    crcFeed();
+    return 0;
+}
+
+uint32_t DMAC_CRCCalculate(void* buffer, uint32_t length, DMAC_CRC_SETUP CRCSetup){
+    crcPending = false;
+    crcRegister = crc32Update(CRCSetup.seed, (const uint8_t*) buffer, length);
+    return ~crcRegister;
+}
+
+uint32_t DMAC_CRCRead(void){
+    crcFeed();
+    return ~crcRegister;
+}
+
+// DSU and PAC
+
+void PAC_PeripheralProtectSetup(PAC_PERIPHERAL peripheral, PAC_PROTECTION operation){
+    (void) peripheral;
+    (void) operation;
+}
+
+bool DSU_CRCCalculate(uint32_t addr, uint32_t length, uint32_t seed, uint32_t* crc){
+    if((addr & 0x3) || (length & 0x3) || (addr + length > MOCK_FLASH_SIZE)) return false;
+
+    *crc = crc32Update(seed, FLASH_PTR(addr), length);
+    mockAdvance((length / 4) * DSU_WORD_TIME);
+    return true;
+}
+
+// CAN
+
+/**
+ * Stores a frame received from the link into the RX FIFO0
+ * and sets the RF0N flag.
+ *
+ * @return false if the FIFO is full (frame lost)
+ */
+bool mockCanDeliver(const MOCK_CAN_FRAME_t* frame){
+    if(mockCan.level >= mockCan.depth){
+        mockCan.overflows++;
+        return false;
+    }
+
+    mockCan.fifo[(mockCan.get + mockCan.level) % MOCK_RX_FIFO_MAX] = *frame;
+    mockCan.level++;
+    mockCan.rf0n = true;
+    return true;
+}
+
+bool _MessageTransmit(uint32_t id, uint8_t length, uint8_t* data, MOCK_CAN_MODE mode, MOCK_CAN_TX_ATTRIBUTE msgAttr){
+    MOCK_CAN_FRAME_t frame;
+
+    (void) mode;
+    (void) msgAttr;
+    if(length > MOCK_CAN_MAX_DATA) return false;
+
+    frame.id = id;
+    frame.length = length;
+    memcpy(frame.data, data, length);
+    mockDeviceTransmit(&frame);
+    return true;
+}
+
+bool _MessageReceive(uint32_t* id, uint8_t* length, uint8_t* data, uint16_t timestamp,
+                     MOCK_CAN_RX_ATTRIBUTE msgAttr, _MSG_RX_FRAME_ATTRIBUTE* msgFrameAttr){
+    (void) timestamp;
+    (void) msgAttr;
+    if(mockCan.level == 0) return false;
+
+    MOCK_CAN_FRAME_t* frame = &mockCan.fifo[mockCan.get];
+    *id = frame->id;
+    *length = frame->length;
+    memcpy(data, frame->data, frame->length);
+    *msgFrameAttr = _MSG_RX_DATA_FRAME;
+
+    mockCan.get = (mockCan.get + 1) % MOCK_RX_FIFO_MAX;
+    mockCan.level--;
+    mockAdvance(RX_FRAME_TIME);
+    return true;
+}
+
+void _MessageRAMConfigSet(uint8_t* msgRAMConfigBaseAddress){
+    (void) msgRAMConfigBaseAddress;
+}
+
+bool _InterruptGet(uint32_t interruptMask){
+    if(interruptMask & _INTERRUPT_RF0N_MASK) return mockCan.rf0n;
+    if(interruptMask & _INTERRUPT_TFE_MASK){
+        if(mockNow() >= mockCan.txIdleAt) return true;
+        mockAdvance(NVM_POLL_TIME);
+        return false;
+    }
+    return false;
+}
+
+void _InterruptClear(uint32_t interruptMask){
+    if(interruptMask & _INTERRUPT_RF0N_MASK) mockCan.rf0n = false;
+}
+
+uint32_t _ErrorGet(void){
+    return _ERROR_NONE;
+}
+
+// CMSIS
+
+void NVIC_SystemReset(void){
+}
+
+void __set_MSP(uint32_t topOfMainStack){
+    (void) topOfMainStack;
+}
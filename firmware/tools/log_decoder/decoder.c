@@ -0,0 +1,185 @@
+/*
+ * Host decoder of the binary diagnostic log (Log module)
+ *
+ * The records transmitted by the device on the SERCOM5 TX pin (PB02, 2Mbaud 8N1)
+ * are read from a capture file, a serial device or the standard input:
+ *
+ *   stty -F /dev/ttyUSB0 2000000 raw && log_decoder /dev/ttyUSB0
+ *
+ * Every record is printed as a text line with the format table of src/Log/log_formats.h
+ * (the same LOG_FORMATS() list compiled in the firmware):
+ *
+ *   time_us  sequence  text
+ *
+ * The time is the DWT cycle counter of the record converted with -c MHz (default 120),
+ * from the first record decoded: the counter overflows are tracked between two records
+ * (the time between two records shall be less than 35s at 120MHz).
+ *
+ * The decoder searches LOG_SYNC and validates the record with the checksum:
+ * after an error it resynchronizes on the next LOG_SYNC byte.
+ * The gaps in the sequence numbers are the records lost by the device (buffer full)
+ * or discarded by the decoder (checksum errors).
+ *
+ * At the end the summary is printed: records decoded, records lost,
+ * checksum errors, bytes skipped and unknown formats.
+ * The exit status is 1 if any checksum error or unknown format is found.
+ *
+ * usage: log_decoder [-q] [-c cpu_mhz] [capture]
+ * -q: prints only the summary
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include "Log/log_formats.h"
+
+#define LOG_ID(id, text) id,
+#define LOG_TEXT(id, text) text,
+
+typedef enum{
+    LOG_FORMATS(LOG_ID)
+    LOG_FORMATS_NUM
+}LOG_FORMAT_ENUM_t;
+
+static const char* formatText[LOG_FORMATS_NUM] = { LOG_FORMATS(LOG_TEXT) };
+
+static bool quiet = false;
+static double cpuMhz = 120;
+
+static uint8_t window[LOG_RECORD_SIZE(LOG_MAX_ARGS)];  //!< Bytes received not yet decoded
+static uint32_t windowLevel = 0;
+
+static bool started = false;        //!< First record decoded
+static uint32_t lastStamp;          //!< Cycle counter of the last record
+static uint64_t cycles;             //!< Cycles from the first record
+static uint8_t expectedSequence;
+
+static uint32_t records = 0;
+static uint32_t lost = 0;
+static uint32_t checksumErrors = 0;
+static uint32_t skipped = 0;
+static uint32_t unknown = 0;
+
+static uint32_t readWord(const uint8_t* data){
+    return (uint32_t) data[0] | ((uint32_t) data[1] << 8) | ((uint32_t) data[2] << 16) | ((uint32_t) data[3] << 24);
+}
+
+static void discard(uint32_t count){
+    memmove(window, &window[count], windowLevel - count);
+    windowLevel -= count;
+}
+
+static void decodeRecord(const uint8_t* record){
+    uint8_t id = record[1];
+    uint8_t sequence = record[2];
+    uint8_t count = record[3];
+    uint32_t stamp = readWord(&record[4]);
+    uint32_t args[LOG_MAX_ARGS] = {0};
+
+    for(int i = 0; i < count; i++) args[i] = readWord(&record[LOG_HEADER_SIZE + 4 * i]);
+
+    if(started){
+        lost += (uint8_t) (sequence - expectedSequence);
+        cycles += (uint32_t) (stamp - lastStamp);
+    }
+    started = true;
+    lastStamp = stamp;
+    expectedSequence = sequence + 1;
+    records++;
+
+    if(id >= LOG_FORMATS_NUM){
+        unknown++;
+        if(!quiet) printf("%14.3f %3u unknown format %u (%u arguments)\n", cycles / cpuMhz, sequence, id, count);
+        return;
+    }
+    if(quiet) return;
+
+    printf("%14.3f %3u ", cycles / cpuMhz, sequence);
+    printf(formatText[id], args[0], args[1], args[2], args[3]);
+    putchar('\n');
+}
+
+/**
+ * Decodes the records in the window.
+ */
+static void decodeWindow(void){
+    while(windowLevel){
+        if(window[0] != LOG_SYNC){
+            skipped++;
+            discard(1);
+            continue;
+        }
+        if(windowLevel < LOG_HEADER_SIZE) return;
+
+        uint8_t count = window[3];
+        if(count > LOG_MAX_ARGS){
+            skipped++;
+            discard(1);
+            continue;
+        }
+
+        uint32_t size = LOG_RECORD_SIZE(count);
+        if(windowLevel < size) return;
+
+        uint8_t sum = 0;
+        for(uint32_t i = 1; i < size; i++) sum += window[i];
+        if(sum){
+            checksumErrors++;
+            skipped++;
+            discard(1);
+            continue;
+        }
+
+        decodeRecord(window);
+        discard(size);
+    }
+}
+
+int main(int argc, char** argv){
+    int opt;
+    int fd = STDIN_FILENO;
+
+    while((opt = getopt(argc, argv, "qc:")) != -1){
+        switch(opt){
+            case 'q': quiet = true; break;
+            case 'c': cpuMhz = atof(optarg); break;
+            default:
+                fprintf(stderr, "usage: log_decoder [-q] [-c cpu_mhz] [capture]\n");
+                return 2;
+        }
+    }
+    if(cpuMhz <= 0){
+        fprintf(stderr, "usage: log_decoder [-q] [-c cpu_mhz] [capture]\n");
+        return 2;
+    }
+    if(optind < argc){
+        fd = open(argv[optind], O_RDONLY);
+        if(fd < 0){
+            perror(argv[optind]);
+            return 2;
+        }
+    }
+
+    // A live serial device: every line is printed when decoded
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    uint8_t chunk[4096];
+    ssize_t length;
+    while((length = read(fd, chunk, sizeof(chunk))) > 0){
+        for(ssize_t i = 0; i < length; i++){
+            window[windowLevel++] = chunk[i];
+            if(windowLevel == sizeof(window) || window[0] != LOG_SYNC || windowLevel >= LOG_HEADER_SIZE) decodeWindow();
+        }
+    }
+    decodeWindow();
+    skipped += windowLevel;
+
+    printf("Records %u, lost %u, checksum errors %u, bytes skipped %u, unknown formats %u\n",
+           records, lost, checksumErrors, skipped, unknown);
+
+    return (checksumErrors || unknown) ? 1 : 0;
+}
@@ -0,0 +1,101 @@
+/*
+ * Host replacement of the Harmony 3 definitions.h
+ *
+ * Only the objects used by the Log module are declared:
+ * - DWT cycle counter and RSTC reset cause;
+ * - SERCOM5 USART DATA register and transmit complete flag;
+ * - DMAC channel 2 (SERCOM5 TX trigger, transfer complete callback);
+ * - the CMSIS exclusive access intrinsics and the memory barrier.
+ *
+ * The mocks run a cycle based simulation of the CPU at 120MHz (see mock.c):
+ * the exclusive access intrinsics and the barrier advance the time
+ * and are the points where the pending interrupts preempt the running code.
+ * The simulation state is exported so the self test can drive it.
+ */
+#ifndef _MOCK_DEFINITIONS_H
+#define _MOCK_DEFINITIONS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define __ALIGNED(x) __attribute__((aligned(x)))
+
+// DWT and RSTC
+typedef struct{
+    volatile uint32_t CYCCNT;
+}DWT_Type;
+
+typedef struct{
+    uint8_t RSTC_RCAUSE;
+}rstc_registers_t;
+
+extern DWT_Type mockDwt;
+extern rstc_registers_t mockRstc;
+
+#define DWT         (&mockDwt)
+#define RSTC_REGS   (&mockRstc)
+
+// SERCOM5 USART (TX only)
+typedef struct{
+    struct{
+        volatile uint32_t SERCOM_DATA;
+    }USART_INT;
+}sercom_registers_t;
+
+extern sercom_registers_t mockSercom5;
+
+#define SERCOM5_REGS    (&mockSercom5)
+
+bool SERCOM5_USART_TransmitComplete(void);
+
+// DMAC
+typedef enum{
+    DMAC_CHANNEL_2 = 2,
+}DMAC_CHANNEL;
+
+typedef enum{
+    DMAC_TRANSFER_EVENT_COMPLETE,
+    DMAC_TRANSFER_EVENT_ERROR
+}DMAC_TRANSFER_EVENT;
+
+typedef void (*DMAC_CHANNEL_CALLBACK)(DMAC_TRANSFER_EVENT event, uintptr_t contextHandle);
+
+void DMAC_ChannelCallbackRegister(DMAC_CHANNEL channel, const DMAC_CHANNEL_CALLBACK eventHandler, const uintptr_t contextHandle);
+bool DMAC_ChannelTransfer(DMAC_CHANNEL channel, const void *srcAddr, const void *destAddr, size_t blockSize);
+
+// CMSIS
+uint32_t __LDREXW(volatile uint32_t* addr);
+uint32_t __STREXW(uint32_t value, volatile uint32_t* addr);
+void __CLREX(void);
+void mockBarrier(void);
+
+#define __DMB()     mockBarrier()
+
+// Simulation (mock.c)
+#define MOCK_CPU_MHZ        120         //!< CPU clock (MHz)
+#define MOCK_BYTE_CYCLES    600         //!< UART byte time (cycles): 10 bits at 2Mbaud
+
+/// Simulation state
+typedef struct{
+    uint64_t now;               //!< Time (CPU cycles)
+    bool inIsr;                 //!< An interrupt routine is running (same priority: no nesting)
+    void (*timerIsr)(void);     //!< Periodic interrupt routine (motor step), NULL = disabled
+    uint64_t timerAt;           //!< Next periodic interrupt time
+
+    uint8_t* capture;           //!< Bytes transmitted by the UART
+    size_t captured;
+    size_t captureSize;
+
+    uint32_t preemptions;       //!< Interrupts executed at a preemption point of the running code
+    uint32_t strexFailures;     //!< Store exclusive failed because of an interrupt
+    uint32_t transfers;         //!< DMAC transfers
+}MOCK_SIM_t;
+
+extern MOCK_SIM_t mockSim;
+
+void mockAdvance(uint32_t cycles);
+bool mockInterrupts(void);
+
+#endif
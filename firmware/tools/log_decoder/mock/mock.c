@@ -0,0 +1,156 @@
+/*
+ * Host mocks of the peripherals used by the Log module:
+ * DWT cycle counter, DMAC channel 2 and SERCOM5 TX, exclusive monitor.
+ *
+ * The DMAC moves a byte to the SERCOM5 DATA register every UART byte time:
+ * the byte is read from the source buffer when it is moved, so a record
+ * overwritten before its transmission is captured corrupted.
+ * The transfer complete interrupt is pending after the last byte.
+ *
+ * The interrupts (DMAC, periodic timer) are executed at the preemption points
+ * of the running code: an exclusive load or store and a barrier.
+ * An interrupt clears the exclusive monitor, as on the Cortex-M4 exception return:
+ * the next store exclusive fails.
+ */
+#include <stdlib.h>
+#include "definitions.h"
+
+#define LDREX_CYCLES    2       //!< Time of an exclusive load
+#define STREX_CYCLES    2       //!< Time of an exclusive store
+#define DMB_CYCLES      4       //!< Time of a barrier
+#define ISR_CYCLES      30      //!< Interrupt entry and exit time
+
+DWT_Type mockDwt;
+rstc_registers_t mockRstc;
+sercom_registers_t mockSercom5;
+MOCK_SIM_t mockSim;
+
+static DMAC_CHANNEL_CALLBACK dmacCallback;
+static uintptr_t dmacContext;
+static const uint8_t* dmacSource;   //!< Next byte of the transfer in progress
+static size_t dmacRemaining;        //!< Bytes left in the transfer in progress
+static uint64_t dmacNextByte;       //!< Time of the next byte move
+static bool dmacBusy;               //!< Transfer in progress
+static bool dmacPending;            //!< Transfer complete interrupt pending
+static uint64_t txIdleAt;           //!< End of the last byte shift out
+static bool monitorOpen;            //!< Exclusive monitor state
+
+static void captureByte(uint8_t value){
+    if(mockSim.captured == mockSim.captureSize){
+        mockSim.captureSize = (mockSim.captureSize) ? 2 * mockSim.captureSize : 65536;
+        mockSim.capture = realloc(mockSim.capture, mockSim.captureSize);
+    }
+    mockSim.capture[mockSim.captured++] = value;
+}
+
+/**
+ * Advances the time: the DMAC moves the bytes due in the meantime.
+ */
+void mockAdvance(uint32_t cycles){
+    mockSim.now += cycles;
+    mockDwt.CYCCNT = (uint32_t) mockSim.now;
+
+    while(dmacBusy && (mockSim.now >= dmacNextByte)){
+        mockSercom5.USART_INT.SERCOM_DATA = *dmacSource++;
+        captureByte((uint8_t) mockSercom5.USART_INT.SERCOM_DATA);
+        txIdleAt = dmacNextByte + MOCK_BYTE_CYCLES;
+        dmacNextByte += MOCK_BYTE_CYCLES;
+        if(--dmacRemaining == 0){
+            dmacBusy = false;
+            dmacPending = true;
+        }
+    }
+}
+
+/**
+ * Executes the pending interrupts (not from an interrupt routine).
+ *
+ * @return true if at least an interrupt has been executed
+ */
+bool mockInterrupts(void){
+    bool executed = false;
+
+    if(mockSim.inIsr) return false;
+
+    while(true){
+        if(dmacPending){
+            dmacPending = false;
+            mockSim.inIsr = true;
+            mockAdvance(ISR_CYCLES);
+            if(dmacCallback) dmacCallback(DMAC_TRANSFER_EVENT_COMPLETE, dmacContext);
+            mockSim.inIsr = false;
+        }else if(mockSim.timerIsr && (mockSim.now >= mockSim.timerAt)){
+            mockSim.inIsr = true;
+            mockAdvance(ISR_CYCLES);
+            mockSim.timerIsr();
+            mockSim.inIsr = false;
+        }else break;
+
+        executed = true;
+        monitorOpen = false;
+    }
+    return executed;
+}
+
+static void preemptionPoint(void){
+    if(mockInterrupts()) mockSim.preemptions++;
+}
+
+// SERCOM5
+
+bool SERCOM5_USART_TransmitComplete(void){
+    return !dmacBusy && (mockSim.now >= txIdleAt);
+}
+
+// DMAC
+
+void DMAC_ChannelCallbackRegister(DMAC_CHANNEL channel, const DMAC_CHANNEL_CALLBACK eventHandler, const uintptr_t contextHandle){
+    (void) channel;
+    dmacCallback = eventHandler;
+    dmacContext = contextHandle;
+}
+
+bool DMAC_ChannelTransfer(DMAC_CHANNEL channel, const void *srcAddr, const void *destAddr, size_t blockSize){
+    (void) channel;
+    (void) destAddr;
+    if(dmacBusy || dmacPending || (blockSize == 0)) return false;
+
+    dmacSource = (const uint8_t*) srcAddr;
+    dmacRemaining = blockSize;
+    // The DATA register is free one byte time before the end of the shift out
+    uint64_t dataFree = (txIdleAt > MOCK_BYTE_CYCLES) ? txIdleAt - MOCK_BYTE_CYCLES : 0;
+    dmacNextByte = (mockSim.now > dataFree) ? mockSim.now : dataFree;
+    dmacBusy = true;
+    mockSim.transfers++;
+    return true;
+}
+
+// CMSIS
+
+uint32_t __LDREXW(volatile uint32_t* addr){
+    preemptionPoint();
+    mockAdvance(LDREX_CYCLES);
+    monitorOpen = true;
+    return *addr;
+}
+
+uint32_t __STREXW(uint32_t value, volatile uint32_t* addr){
+    preemptionPoint();
+    mockAdvance(STREX_CYCLES);
+    if(!monitorOpen){
+        mockSim.strexFailures++;
+        return 1;
+    }
+    monitorOpen = false;
+    *addr = value;
+    return 0;
+}
+
+void __CLREX(void){
+    monitorOpen = false;
+}
+
+void mockBarrier(void){
+    preemptionPoint();
+    mockAdvance(DMB_CYCLES);
+}
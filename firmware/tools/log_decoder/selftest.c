@@ -0,0 +1,201 @@
+/*
+ * Self test of the Log module on the host
+ *
+ * The Log/log.c source is compiled on the host against the mocks of the DWT,
+ * DMAC channel 2, SERCOM5 TX and of the exclusive monitor (see mock/).
+ * The CPU runs at 120MHz and the UART at 2Mbaud (600 cycles per byte).
+ *
+ * The test replays a filter positioning:
+ * - the motor step interrupt writes a LOG_FILTER_STEP record (4 arguments) every period,
+ *   with the speed ramp of MOTOR_SPEED_HOME (1500us to 150us, -20us every period);
+ * - the Motion task writes a record every -t us during the motion;
+ * - after the motion, the task writes a record every 2us for 5ms (overload):
+ *   the buffer fills and the records are dropped.
+ * The interrupts preempt the task at the exclusive accesses and at the barriers
+ * of LogWrite(): the nested writers and the store exclusive retries are exercised.
+ *
+ * At the end the UART output is written to the capture file, to be decoded with log_decoder.
+ * With -n the given number of random bytes of the capture are corrupted (decoder resync test).
+ *
+ * The test fails if the buffer isn't completely transmitted and released at the end,
+ * or if the sequence numbers in the capture don't match the records written and dropped
+ * (the gaps are seen modulo 256 by the decoder).
+ *
+ * usage: log_selftest [-s steps] [-t task_period_us] [-n corrupted_bytes] [-S seed] capture.bin
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "definitions.h"
+#include "Log/log.c"
+
+#define US(x)               ((uint64_t) (x) * MOCK_CPU_MHZ)
+#define STEP_INIT_PERIOD    1500    //!< Initial step period (us)
+#define STEP_FINAL_PERIOD   150     //!< Final step period (us)
+#define STEP_RAMP           20      //!< Period decrease every step (us)
+#define OVERLOAD_TIME       5000    //!< Back to back task records after the motion (us)
+#define TASK_LOOP_CYCLES    40      //!< Task loop time between two records
+#define OVERLOAD_PERIOD     2       //!< Task record period in the overload (us)
+
+static uint32_t steps = 4000;       //!< Steps of the motion
+static uint32_t stepCount;
+static uint32_t stepPeriod;
+static uint32_t written;            //!< Records written
+static uint32_t dropped;            //!< Records dropped (buffer full)
+static uint32_t isrWritten;         //!< Records written by the interrupt routine
+static uint32_t droppedRun;         //!< Records dropped since the last record written
+static uint32_t expectedLost;       //!< Sequence gaps expected in the capture (8 bit sequence)
+
+static void logCount(bool result){
+    if(result){
+        written++;
+        expectedLost += droppedRun & 0xFF;
+        droppedRun = 0;
+    }else{
+        dropped++;
+        droppedRun++;
+    }
+}
+
+/**
+ * Motor step interrupt routine (filterCallback())
+ */
+static void stepIsr(void){
+    stepCount++;
+    if(stepPeriod > STEP_FINAL_PERIOD) stepPeriod -= STEP_RAMP;
+    if(stepPeriod < STEP_FINAL_PERIOD) stepPeriod = STEP_FINAL_PERIOD;
+
+    logCount(LOG4(LOG_FILTER_STEP, stepCount % 17, stepCount & 1, steps - stepCount, stepPeriod));
+    isrWritten++;
+
+    if(stepCount >= steps) mockSim.timerIsr = NULL;
+    else mockSim.timerAt += US(stepPeriod);
+}
+
+/**
+ * Task context: runs the interrupts and advances the time to the given instant.
+ */
+static void taskWait(uint64_t until){
+    while(mockSim.now < until){
+        uint64_t cycles = until - mockSim.now;
+        mockAdvance((cycles < TASK_LOOP_CYCLES) ? cycles : TASK_LOOP_CYCLES);
+        mockInterrupts();
+    }
+}
+
+/**
+ * Checks the sequence numbers of the capture (valid records only).
+ *
+ * @return the number of records found, lost is the sum of the sequence gaps
+ */
+static uint32_t captureCheck(const uint8_t* data, size_t size, uint32_t* lost){
+    uint32_t records = 0;
+    int expected = -1;
+
+    *lost = 0;
+    for(size_t i = 0; i + LOG_HEADER_SIZE < size; ){
+        uint8_t count = data[i + 3];
+        if((data[i] != LOG_SYNC) || (count > LOG_MAX_ARGS) || (i + LOG_RECORD_SIZE(count) > size)){
+            i++;
+            continue;
+        }
+
+        uint8_t sum = 0;
+        for(size_t j = 1; j < LOG_RECORD_SIZE(count); j++) sum += data[i + j];
+        if(sum){
+            i++;
+            continue;
+        }
+
+        uint8_t sequence = data[i + 2];
+        if(expected >= 0) *lost += (uint8_t) (sequence - expected);
+        expected = (uint8_t) (sequence + 1);
+        records++;
+        i += LOG_RECORD_SIZE(count);
+    }
+    return records;
+}
+
+int main(int argc, char** argv){
+    uint32_t taskPeriod = 500;
+    uint32_t corrupted = 0;
+    unsigned seed = 1;
+    int opt;
+
+    while((opt = getopt(argc, argv, "s:t:n:S:")) != -1){
+        switch(opt){
+            case 's': steps = atoi(optarg); break;
+            case 't': taskPeriod = atoi(optarg); break;
+            case 'n': corrupted = atoi(optarg); break;
+            case 'S': seed = atoi(optarg); break;
+            default:
+                fprintf(stderr, "usage: log_selftest [-s steps] [-t task_period_us] [-n corrupted_bytes] [-S seed] capture.bin\n");
+                return 2;
+        }
+    }
+    if((optind >= argc) || (steps == 0) || (taskPeriod == 0)){
+        fprintf(stderr, "usage: log_selftest [-s steps] [-t task_period_us] [-n corrupted_bytes] [-S seed] capture.bin\n");
+        return 2;
+    }
+    srand(seed);
+
+    mockRstc.RSTC_RCAUSE = 0x40;
+    LogInit();
+    written = 1;
+
+    // Motion: step interrupt and periodic task records
+    logCount(LOG2(LOG_FILTER_START, 0x11, 4));
+    stepPeriod = STEP_INIT_PERIOD;
+    mockSim.timerAt = mockSim.now + US(stepPeriod);
+    mockSim.timerIsr = stepIsr;
+    while(mockSim.timerIsr){
+        uint64_t at = mockSim.now + US(taskPeriod) + (rand() % MOCK_CPU_MHZ);
+        // One record in four just before the step interrupt: the interrupt preempts LogWrite()
+        if(((rand() & 3) == 0) && (mockSim.timerAt > mockSim.now + 16) && (mockSim.timerAt < at)) at = mockSim.timerAt - (rand() % 16);
+        taskWait(at);
+        logCount(LOG1(LOG_FILTER_TIMEOUT, stepCount));
+    }
+    logCount(LOG2(LOG_FILTER_STOP, 1, 1));
+    uint32_t motionDropped = dropped;
+
+    // Overload: task records faster than the UART
+    uint64_t end = mockSim.now + US(OVERLOAD_TIME);
+    while(mockSim.now < end){
+        logCount(LOG4(LOG_FILTER_STEP, 0, 0, 0, 0));
+        taskWait(mockSim.now + US(OVERLOAD_PERIOD));
+    }
+
+    // Drain
+    end = mockSim.now + US(100000);
+    while(LogIsBusy() && (mockSim.now < end)) taskWait(mockSim.now + US(10));
+
+    uint32_t state = logState;
+    bool drained = !LogIsBusy() && (LOG_WRITERS(state) == 0) && (LOG_PUBLISHED(state) == LOG_HEAD(state)) && (logTail == LOG_HEAD(state));
+
+    uint32_t lost;
+    uint32_t records = captureCheck(mockSim.capture, mockSim.captured, &lost);
+    bool valid = (records == written) && (lost == expectedLost);
+
+    printf("Motion: %u steps, %u step records, task period %uus: %u records dropped\n", stepCount, isrWritten, taskPeriod, motionDropped);
+    printf("Overload: %u records dropped\n", dropped - motionDropped);
+    printf("Records written %u, dropped %u (%u gaps expected); captured %u, lost %u: %s\n", written, dropped, expectedLost, records, lost, (valid) ? "OK" : "MISMATCH");
+    printf("Preemptions %u, store exclusive retries %u, DMAC transfers %u, %zu bytes in %.1fms\n",
+           mockSim.preemptions, mockSim.strexFailures, mockSim.transfers, mockSim.captured, (double) mockSim.now / (MOCK_CPU_MHZ * 1000.0));
+    printf("Buffer %s\n", (drained) ? "drained" : "NOT DRAINED");
+
+    for(uint32_t i = 0; (i < corrupted) && mockSim.captured; i++){
+        mockSim.capture[rand() % mockSim.captured] ^= (uint8_t) (1 + rand() % 255);
+    }
+    if(corrupted) printf("%u bytes corrupted\n", corrupted);
+
+    FILE* file = fopen(argv[optind], "wb");
+    if(!file || (fwrite(mockSim.capture, 1, mockSim.captured, file) != mockSim.captured)){
+        fprintf(stderr, "cannot write %s\n", argv[optind]);
+        return 2;
+    }
+    fclose(file);
+
+    return (valid && drained) ? 0 : 1;
+}
@@ -0,0 +1,35 @@
+/*
+ * Host replacement of the MET_Can_Protocol library interface
+ *
+ * The STATUS, PARAMETER and ERROR registers are plain arrays:
+ * the replay engine reads the error bits written by the protocol error setters.
+ */
+#ifndef _MOCK_MET_CAN_PROTOCOL_H
+#define _MOCK_MET_CAN_PROTOCOL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define MET_COMMAND_ABORT                   0
+#define MET_CAN_COMMAND_BUSY                1
+#define MET_CAN_COMMAND_INVALID_DATA        2
+#define MET_CAN_COMMAND_NOT_AVAILABLE       3
+#define MET_CAN_COMMAND_APPLICATION_ERRORS  10
+
+#define MOCK_STATUS_REGISTERS   4
+#define MOCK_PARAM_REGISTERS    16
+
+extern uint8_t mockStatus[MOCK_STATUS_REGISTERS][4];
+extern uint8_t mockParam[MOCK_PARAM_REGISTERS][4];
+extern uint8_t mockErrors[4];    //!< MOM0, MOM1, PERS0, PERS1
+
+void MET_Can_Protocol_SetDefaultParameter(uint8_t idx, uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3);
+uint8_t MET_Can_Protocol_GetParameter(uint8_t idx, uint8_t b);
+void MET_Can_Protocol_SetStatusReg(uint8_t idx, uint8_t b, uint8_t val);
+uint8_t MET_Can_Protocol_GetStatus(uint8_t idx, uint8_t b);
+void MET_Can_Protocol_SetStatusBit(uint8_t idx, uint8_t b, uint8_t mask, bool val);
+bool MET_Can_Protocol_TestStatus(uint8_t idx, uint8_t b, uint8_t mask);
+void MET_Can_Protocol_GetErrors(unsigned char* mom0, unsigned char* mom1, unsigned char* pers0, unsigned char* pers1);
+void MET_Can_Protocol_SetErrors(unsigned char* mom0, unsigned char* mom1, unsigned char* pers0, unsigned char* pers1);
+
+#endif
@@ -0,0 +1,127 @@
+/*
+ * Host replacement of the Harmony 3 definitions.h
+ *
+ * Only the peripheral objects used by the XrayTube module are declared:
+ * ADC0/ADC1 (window monitor and result), DMAC (ring buffer descriptors),
+ * TC0 (fan PWM) and the uc_FAN pin. The FreeRTOS objects used by
+ * the Thermal task are declared only to compile it: the replay engine
+ * calls the control loops directly. The mock state is exported
+ * so the replay engine can drive the peripherals and inspect the outputs.
+ */
+#ifndef _MOCK_DEFINITIONS_H
+#define _MOCK_DEFINITIONS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define __ALIGNED(x) __attribute__((aligned(x)))
+
+// ADC
+typedef enum{
+    ADC_STATUS_NONE = 0,
+    ADC_STATUS_RESRDY = 0x1,
+    ADC_STATUS_OVERRUN = 0x2,
+    ADC_STATUS_WINMON = 0x4,
+}ADC_STATUS;
+
+typedef void (*ADC_CALLBACK)(ADC_STATUS status, uintptr_t context);
+
+typedef struct{
+    uint16_t ADC_RESULT;
+}adc_registers_t;
+
+/// State of a mocked ADC module
+typedef struct{
+    adc_registers_t regs;       //!< Last conversion result
+    ADC_CALLBACK callback;      //!< Registered callback
+    uintptr_t context;
+    uint32_t intenset;          //!< Enabled interrupts (ADC_STATUS mask)
+    bool enabled;
+}MOCK_ADC_t;
+
+extern MOCK_ADC_t mockAdc0;
+extern MOCK_ADC_t mockAdc1;
+
+#define ADC0_REGS (&mockAdc0.regs)
+#define ADC1_REGS (&mockAdc1.regs)
+
+void ADC0_Enable(void);
+void ADC0_ConversionStart(void);
+uint16_t ADC0_ConversionResultGet(void);
+void ADC0_InterruptsEnable(ADC_STATUS interruptMask);
+void ADC0_InterruptsDisable(ADC_STATUS interruptMask);
+void ADC0_InterruptsClear(ADC_STATUS interruptMask);
+void ADC0_CallbackRegister(ADC_CALLBACK callback, uintptr_t context);
+void ADC1_Enable(void);
+void ADC1_ConversionStart(void);
+uint16_t ADC1_ConversionResultGet(void);
+void ADC1_InterruptsEnable(ADC_STATUS interruptMask);
+void ADC1_InterruptsDisable(ADC_STATUS interruptMask);
+void ADC1_InterruptsClear(ADC_STATUS interruptMask);
+void ADC1_CallbackRegister(ADC_CALLBACK callback, uintptr_t context);
+
+// DMAC
+typedef enum{
+    DMAC_CHANNEL_0 = 0,
+    DMAC_CHANNEL_1 = 1,
+    DMAC_CHANNELS_NUMBER
+}DMAC_CHANNEL;
+
+typedef struct{
+    uint16_t DMAC_BTCTRL;
+    uint16_t DMAC_BTCNT;
+    uint32_t DMAC_SRCADDR;
+    uint32_t DMAC_DSTADDR;
+    uint32_t DMAC_DESCADDR;
+}dmac_descriptor_registers_t;
+
+#define DMAC_BTCTRL_VALID_Msk           0x0001
+#define DMAC_BTCTRL_BLOCKACT_NOACT      0x0000
+#define DMAC_BTCTRL_BEATSIZE_HWORD      0x0100
+#define DMAC_BTCTRL_DSTINC_Msk          0x0800
+
+/// State of a mocked DMAC channel: the ring buffer filled by the ADC results
+typedef struct{
+    volatile uint16_t* ring;    //!< Ring buffer start (assigned by the replay engine)
+    uint16_t dim;               //!< Ring buffer items
+    uint16_t index;             //!< Next item to be written
+}MOCK_DMAC_t;
+
+extern MOCK_DMAC_t mockDmac[DMAC_CHANNELS_NUMBER];
+
+bool DMAC_ChannelLinkedListTransfer(DMAC_CHANNEL channel, dmac_descriptor_registers_t* channelDesc);
+
+// TC0 (8 bit normal PWM)
+/// State of the mocked TC0
+typedef struct{
+    bool running;
+    uint8_t cc1;                //!< Compare 1 (duty cycle)
+}MOCK_TC_t;
+
+extern MOCK_TC_t mockTc0;
+
+void TC0_CompareStart(void);
+void TC0_CompareStop(void);
+bool TC0_Compare8bitMatch1Set(uint8_t compareValue);
+
+// PORT
+extern bool mockFanPin;         //!< uc_FAN pin level (low = FAN On)
+
+#define uc_FAN_Set()    (mockFanPin = true)
+#define uc_FAN_Clear()  (mockFanPin = false)
+
+// NVMCTRL (History module structures)
+#define NVMCTRL_FLASH_PAGESIZE  (512U)
+#define NVMCTRL_FLASH_BLOCKSIZE (8192U)
+
+// FreeRTOS (Thermal task)
+typedef uint32_t TickType_t;
+
+#define tskIDLE_PRIORITY    0
+#define pdMS_TO_TICKS(ms)   ((TickType_t) (ms))
+
+TickType_t xTaskGetTickCount(void);
+void vTaskDelayUntil(TickType_t* previousWakeTime, TickType_t timeIncrement);
+
+#endif
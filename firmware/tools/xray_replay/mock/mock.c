@@ -0,0 +1,105 @@
+/*
+ * Host mocks of the peripherals and of the protocol functions
+ * used by the XrayTube module.
+ */
+#include "definitions.h"
+#include "Protocol/protocol.h"
+#include "History/history.h"
+
+MOCK_ADC_t mockAdc0;
+MOCK_ADC_t mockAdc1;
+MOCK_DMAC_t mockDmac[DMAC_CHANNELS_NUMBER];
+MOCK_TC_t mockTc0;
+bool mockFanPin = true;
+
+uint8_t mockStatus[MOCK_STATUS_REGISTERS][4];
+uint8_t mockParam[MOCK_PARAM_REGISTERS][4];
+uint8_t mockErrors[4];
+
+// ADC0
+void ADC0_Enable(void){ mockAdc0.enabled = true; }
+void ADC0_ConversionStart(void){ }
+uint16_t ADC0_ConversionResultGet(void){ return mockAdc0.regs.ADC_RESULT; }
+void ADC0_InterruptsEnable(ADC_STATUS interruptMask){ mockAdc0.intenset |= interruptMask; }
+void ADC0_InterruptsDisable(ADC_STATUS interruptMask){ mockAdc0.intenset &= ~interruptMask; }
+void ADC0_InterruptsClear(ADC_STATUS interruptMask){ }
+void ADC0_CallbackRegister(ADC_CALLBACK callback, uintptr_t context){ mockAdc0.callback = callback; mockAdc0.context = context; }
+
+// ADC1
+void ADC1_Enable(void){ mockAdc1.enabled = true; }
+void ADC1_ConversionStart(void){ }
+uint16_t ADC1_ConversionResultGet(void){ return mockAdc1.regs.ADC_RESULT; }
+void ADC1_InterruptsEnable(ADC_STATUS interruptMask){ mockAdc1.intenset |= interruptMask; }
+void ADC1_InterruptsDisable(ADC_STATUS interruptMask){ mockAdc1.intenset &= ~interruptMask; }
+void ADC1_InterruptsClear(ADC_STATUS interruptMask){ }
+void ADC1_CallbackRegister(ADC_CALLBACK callback, uintptr_t context){ mockAdc1.callback = callback; mockAdc1.context = context; }
+
+// DMAC: the self-linked descriptor describes the ring buffer.
+// The descriptor addresses are 32 bit: on a 64 bit host the replay engine
+// assigns the ring buffer pointer (see replay.c)
+bool DMAC_ChannelLinkedListTransfer(DMAC_CHANNEL channel, dmac_descriptor_registers_t* channelDesc){
+    mockDmac[channel].dim = channelDesc->DMAC_BTCNT;
+    mockDmac[channel].index = 0;
+    return true;
+}
+
+// TC0
+void TC0_CompareStart(void){ mockTc0.running = true; }
+void TC0_CompareStop(void){ mockTc0.running = false; }
+bool TC0_Compare8bitMatch1Set(uint8_t compareValue){ mockTc0.cc1 = compareValue; return true; }
+
+// MET_Can_Protocol library
+void MET_Can_Protocol_SetDefaultParameter(uint8_t idx, uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3){
+    mockParam[idx][0] = d0;
+    mockParam[idx][1] = d1;
+    mockParam[idx][2] = d2;
+    mockParam[idx][3] = d3;
+}
+uint8_t MET_Can_Protocol_GetParameter(uint8_t idx, uint8_t b){ return mockParam[idx][b]; }
+void MET_Can_Protocol_SetStatusReg(uint8_t idx, uint8_t b, uint8_t val){ mockStatus[idx][b] = val; }
+uint8_t MET_Can_Protocol_GetStatus(uint8_t idx, uint8_t b){ return mockStatus[idx][b]; }
+void MET_Can_Protocol_SetStatusBit(uint8_t idx, uint8_t b, uint8_t mask, bool val){
+    if(val) mockStatus[idx][b] |= mask;
+    else mockStatus[idx][b] &= ~mask;
+}
+bool MET_Can_Protocol_TestStatus(uint8_t idx, uint8_t b, uint8_t mask){ return (mockStatus[idx][b] & mask) != 0; }
+void MET_Can_Protocol_GetErrors(unsigned char* mom0, unsigned char* mom1, unsigned char* pers0, unsigned char* pers1){
+    if(mom0) *mom0 = mockErrors[0];
+    if(mom1) *mom1 = mockErrors[1];
+    if(pers0) *pers0 = mockErrors[2];
+    if(pers1) *pers1 = mockErrors[3];
+}
+void MET_Can_Protocol_SetErrors(unsigned char* mom0, unsigned char* mom1, unsigned char* pers0, unsigned char* pers1){
+    if(mom0) mockErrors[0] = *mom0;
+    if(mom1) mockErrors[1] = *mom1;
+    if(pers0) mockErrors[2] = *pers0;
+    if(pers1) mockErrors[3] = *pers1;
+}
+
+/*
+ * Protocol error setters: same behavior of the Protocol/protocol.c functions,
+ * every setter clears the three error bits of the sensor and then sets its own bit.
+ */
+static void setSensorError(uint8_t clear, uint8_t bit, bool stat){
+    mockErrors[2] &= ~clear;
+    if(stat) mockErrors[2] |= bit;
+    SETBIT_FLAGS_ERRORS((mockErrors[2] | mockErrors[3]) != 0);
+}
+
+#define STATOR_ERRORS (PERS0_STATOR_SENS_LOW | PERS0_STATOR_SENS_SHORT | PERS0_STATOR_SENS_HIGH)
+#define BULB_ERRORS (PERS0_BULB_SENS_LOW | PERS0_BULB_SENS_SHORT | PERS0_BULB_SENS_HIGH)
+
+void setStatorErrorLow(bool stat){ setSensorError(STATOR_ERRORS, PERS0_STATOR_SENS_LOW, stat); }
+void setStatorErrorShort(bool stat){ setSensorError(STATOR_ERRORS, PERS0_STATOR_SENS_SHORT, stat); }
+void setStatorErrorHigh(bool stat){ setSensorError(STATOR_ERRORS, PERS0_STATOR_SENS_HIGH, stat); }
+void setBulbErrorLow(bool stat){ setSensorError(BULB_ERRORS, PERS0_BULB_SENS_LOW, stat); }
+void setBulbErrorShort(bool stat){ setSensorError(BULB_ERRORS, PERS0_BULB_SENS_SHORT, stat); }
+void setBulbErrorHigh(bool stat){ setSensorError(BULB_ERRORS, PERS0_BULB_SENS_HIGH, stat); }
+void setFilterError(bool stat){ setSensorError(PERS0_FILTER_SEL_FAIL, PERS0_FILTER_SEL_FAIL, stat); }
+
+// History module: the recording is not part of the replay
+void HistoryRecord(int16_t stator, int16_t bulb, uint8_t duty, uint8_t faults){ }
+
+// FreeRTOS: the Thermal task is not executed by the replay engine
+TickType_t xTaskGetTickCount(void){ return 0; }
+void vTaskDelayUntil(TickType_t* previousWakeTime, TickType_t timeIncrement){ *previousWakeTime += timeIncrement; }
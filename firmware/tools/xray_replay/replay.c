@@ -0,0 +1,461 @@
+/*
+ * Thermal trace replay harness of the XrayTube module
+ *
+ * The XrayTube/xray_tube.c source is compiled on the host against the mocks
+ * of the ADC0/ADC1, DMAC, TC0 and of the protocol error setters (see mock/).
+ * The ADC traces are replayed with a 1ms resolution:
+ * - every millisecond a new sample is written into the DMAC ring buffers
+ *   and checked against the ADC window (the window callback is called
+ *   when the WINMON interrupt is enabled);
+ * - the XrayFanLoop() is called every 125ms and the XrayLoop() every second,
+ *   as the RTC periodic events of the main loop.
+ *
+ * The synthetic scenarios drive the sensors either directly (open loop)
+ * or with a first order thermal model of the tube cooled by the fan (closed loop).
+ * A recorded trace is a text file with "ms,stator_code,bulb_code" lines
+ * (12 bit ADC codes, lines not starting with a digit are skipped):
+ * every code is held until the next line.
+ *
+ * For every run the harness reports:
+ * - the fan response time: from the first valid input temperature above the target
+ *   to the fan start and to the max duty cycle; a scenario with a start limit
+ *   FAILs when the fan starts later (the limits hold with the default fan control);
+ * - the error flag timing: for every PERS0 error bit the delay from the
+ *   first input sample in the error condition to the flag activation, and the release time;
+ * - the number of duty cycle oscillations (direction reversals of OSC_THRESHOLD at least) and the
+ *   duty cycle range in the second half of the run.
+ *
+ * usage: xray_replay [-v] [-t target] [-m min_duty] [-M max_duty] [-s seed] scenario|trace.csv ...
+ *
+ * scenarios: ramp, burst, open, short, noise, all
+ * -v: prints the timeline (one line per second) before the report
+ *
+ * The exit status is 2 when a run FAILs.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "definitions.h"
+#include "XrayTube/xray_tube.c"
+
+#define SIM_TICK_MS         1
+#define SIM_FAN_LOOP_MS     125
+#define SIM_XRAY_LOOP_MS    1000
+
+#define PLANT_AMBIENT       25.0    //!< Ambient temperature (°C)
+#define PLANT_CAPACITY      1500.0  //!< Tube thermal capacity (J/°C)
+#define PLANT_G_NATURAL     1.5     //!< Natural cooling conductance (W/°C)
+#define PLANT_G_FAN         15.0    //!< Fan cooling conductance at 100% (W/°C)
+#define PLANT_BULB_RISE     0.02    //!< Bulb over Stator temperature (°C/W)
+
+#define ERROR_BITS 7
+#define OSC_THRESHOLD 5     //!< Min duty cycle swing (%) counted as a direction reversal
+
+/// Simulation state
+typedef struct{
+    uint32_t t;             //!< Time (ms)
+    double temp;            //!< Plant (Stator) temperature (°C)
+    double power;           //!< Heating power (W)
+    double noise;           //!< Noise standard deviation (ADC codes)
+    uint32_t seed;
+    uint16_t stator;        //!< Stator input code
+    uint16_t bulb;          //!< Bulb input code
+}SIM_t;
+
+typedef struct{
+    const char* name;
+    const char* description;
+    uint32_t duration;      //!< Run duration (ms)
+    uint32_t startLimit;    //!< Max fan start delay after the target crossing (ms), 0 = not checked
+    void (*input)(SIM_t* sim); //!< Sets the input codes (and the plant power) at the current time
+}SCENARIO_t;
+
+/// Results of a run
+typedef struct{
+    uint32_t targetCross;                   //!< First input temperature above the target (ms)
+    uint32_t fanStart;                      //!< First duty cycle > 0 after the target crossing (ms)
+    uint32_t fanMax;                        //!< First max duty cycle after the target crossing (ms)
+    uint32_t onset[ERROR_BITS];             //!< First input in the error condition (ms)
+    uint32_t set[ERROR_BITS];               //!< First error flag activation (ms)
+    uint32_t release[ERROR_BITS];           //!< First error flag release after the activation (ms)
+    uint32_t reversals;                     //!< Duty cycle direction reversals
+    int direction;                          //!< Current duty cycle direction
+    uint8_t extreme;                        //!< Duty cycle extreme in the current direction
+    uint8_t dutyMin, dutyMax;               //!< Duty cycle range in the second half of the run
+    double tempMin, tempMax;                //!< Hottest input temperature range in the second half of the run
+}RESULT_t;
+
+#define NEVER 0xFFFFFFFF
+
+static const char* errorNames[ERROR_BITS] = {
+    "BULB_LOW", "BULB_HIGH", "BULB_SHORT", "STATOR_LOW", "STATOR_HIGH", "STATOR_SHORT", "FILTER_SEL",
+};
+
+static int verbose = 0;
+static uint8_t fanTargetPar = 50;
+static uint8_t fanMinPar = 20;
+static uint8_t fanMaxPar = 100;
+static uint32_t seedPar = 1;
+static int failed = 0;
+
+static const uint16_t calCodes[] = {
+    TEMP_CAL_0, TEMP_CAL_5, TEMP_CAL_10, TEMP_CAL_15, TEMP_CAL_20, TEMP_CAL_25, TEMP_CAL_30, TEMP_CAL_35,
+    TEMP_CAL_40, TEMP_CAL_45, TEMP_CAL_50, TEMP_CAL_55, TEMP_CAL_60, TEMP_CAL_65, TEMP_CAL_70, TEMP_CAL_75,
+    TEMP_CAL_80, TEMP_CAL_85, TEMP_CAL_90, TEMP_CAL_95, TEMP_CAL_100, TEMP_CAL_105,
+};
+#define CAL_POINTS ((int) (sizeof(calCodes) / sizeof(calCodes[0])))
+
+/**
+ * Converts a temperature into the sensor ADC code (inverse of the calibration).
+ */
+static double tempToCode(double temp){
+    int seg = (int) floor(temp / 5.0);
+    if(seg < 0) seg = 0;
+    if(seg > CAL_POINTS - 2) seg = CAL_POINTS - 2;
+    return calCodes[seg] + (calCodes[seg + 1] - calCodes[seg]) * (temp - 5.0 * seg) / 5.0;
+}
+
+/**
+ * Converts a sensor ADC code into the temperature (calibration interpolation).
+ */
+static double codeToTempC(uint16_t code){
+    int seg;
+    for(seg = 0; seg < CAL_POINTS - 2; seg++) if(code < calCodes[seg + 1]) break;
+    return 5.0 * seg + 5.0 * ((double) code - calCodes[seg]) / (calCodes[seg + 1] - calCodes[seg]);
+}
+
+static double randomGauss(SIM_t* sim){
+    double sum = 0;
+    for(int i = 0; i < 12; i++){
+        sim->seed = sim->seed * 1103515245 + 12345;
+        sum += ((sim->seed >> 8) & 0xFFFF) / 65536.0;
+    }
+    return sum - 6.0;
+}
+
+static uint16_t sampleCode(SIM_t* sim, double code){
+    code += sim->noise * randomGauss(sim);
+    if(code < 0) return 0;
+    if(code > 4095) return 4095;
+    return (uint16_t) lround(code);
+}
+
+/// Closed loop sensors: the plant temperature
+static void plantInput(SIM_t* sim){
+    sim->stator = sampleCode(sim, tempToCode(sim->temp));
+    sim->bulb = sampleCode(sim, tempToCode(sim->temp + PLANT_BULB_RISE * sim->power));
+}
+
+// Scenario: open loop heat-up ramp, 25°C to 95°C in 10 minutes
+static void rampInput(SIM_t* sim){
+    double t = sim->t / 1000.0;
+    double temp = 25.0 + ((t < 30) ? 0 : (t > 630) ? 70.0 : (t - 30) * 70.0 / 600.0);
+    sim->stator = sampleCode(sim, tempToCode(temp));
+    sim->bulb = sampleCode(sim, tempToCode(temp - 3.0));
+}
+
+// Scenario: closed loop exposure bursts, 300W for 3 minutes every 5 minutes
+static void burstInput(SIM_t* sim){
+    uint32_t t = sim->t / 1000;
+    sim->power = ((t >= 30) && (((t - 30) % 300) < 180)) ? 300.0 : 0.0;
+    plantInput(sim);
+}
+
+// Scenario: Stator sensor open between 60s and 90s
+static void openInput(SIM_t* sim){
+    uint32_t t = sim->t / 1000;
+    sim->stator = ((t >= 60) && (t < 90)) ? sampleCode(sim, 300) : sampleCode(sim, tempToCode(40.0));
+    sim->bulb = sampleCode(sim, tempToCode(45.0));
+}
+
+// Scenario: Bulb sensor short between 60s and 90s
+static void shortInput(SIM_t* sim){
+    uint32_t t = sim->t / 1000;
+    sim->stator = sampleCode(sim, tempToCode(40.0));
+    sim->bulb = ((t >= 60) && (t < 90)) ? sampleCode(sim, 4000) : sampleCode(sim, tempToCode(45.0));
+}
+
+// Scenario: closed loop steady heat with a noisy acquisition
+static void noiseInput(SIM_t* sim){
+    sim->power = 300.0;
+    sim->noise = 24.0;
+    plantInput(sim);
+}
+
+static const SCENARIO_t scenarios[] = {
+    {"ramp",  "open loop heat-up ramp 25-95 C in 10 min",          720000, 8000, rampInput},
+    {"burst", "closed loop 300W bursts, 3 min every 5 min",        1230000, 2000, burstInput},
+    {"open",  "Stator sensor open from 60s to 90s",                 150000, 0, openInput},
+    {"short", "Bulb sensor short from 60s to 90s",                  150000, 0, shortInput},
+    {"noise", "closed loop 300W with 24 codes RMS noise",          1200000, 0, noiseInput},
+};
+#define SCENARIOS ((int) (sizeof(scenarios) / sizeof(scenarios[0])))
+
+// Recorded trace
+static uint32_t* traceTime;
+static uint16_t* traceStator;
+static uint16_t* traceBulb;
+static size_t traceLen;
+static size_t traceIndex;
+
+static void traceInput(SIM_t* sim){
+    while((traceIndex + 1 < traceLen) && (traceTime[traceIndex + 1] <= sim->t)) traceIndex++;
+    sim->stator = traceStator[traceIndex];
+    sim->bulb = traceBulb[traceIndex];
+}
+
+static bool traceLoad(const char* fname, SCENARIO_t* sc){
+    char line[256];
+    size_t cap = 0;
+    FILE* f = fopen(fname, "r");
+    if(!f) return false;
+
+    traceLen = 0;
+    traceIndex = 0;
+    while(fgets(line, sizeof(line), f)){
+        unsigned long t, s, b;
+        if((line[0] < '0') || (line[0] > '9')) continue;
+        if(sscanf(line, "%lu , %lu , %lu", &t, &s, &b) != 3) continue;
+        if(traceLen == cap){
+            cap = cap ? 2 * cap : 1024;
+            traceTime = realloc(traceTime, cap * sizeof(*traceTime));
+            traceStator = realloc(traceStator, cap * sizeof(*traceStator));
+            traceBulb = realloc(traceBulb, cap * sizeof(*traceBulb));
+        }
+        traceTime[traceLen] = (uint32_t) t;
+        traceStator[traceLen] = (uint16_t) s;
+        traceBulb[traceLen] = (uint16_t) b;
+        traceLen++;
+    }
+    fclose(f);
+    if(traceLen == 0) return false;
+
+    sc->name = fname;
+    sc->description = "recorded trace";
+    sc->duration = traceTime[traceLen - 1] + 5000;
+    sc->startLimit = 0;
+    sc->input = traceInput;
+    return true;
+}
+
+/// Returns the duty cycle applied to the fan pin
+static uint8_t fanDuty(void){
+    if(mockTc0.running) return mockTc0.cc1;
+    return mockFanPin ? 0 : 100;
+}
+
+/// Writes a sample into the ring buffer of a DMAC channel and emulates the ADC window monitor
+static void adcSample(MOCK_ADC_t* adc, DMAC_CHANNEL ch, uint16_t code){
+    MOCK_DMAC_t* dma = &mockDmac[ch];
+
+    adc->regs.ADC_RESULT = code;
+    if(dma->ring){
+        dma->ring[dma->index] = code;
+        if(++dma->index >= dma->dim) dma->index = 0;
+    }
+    if((adc->intenset & ADC_STATUS_WINMON) && adc->callback &&
+       ((code < SENSOR_OPEN_LIMIT) || (code > SENSOR_SHORT_LIMIT))) adc->callback(ADC_STATUS_WINMON, adc->context);
+}
+
+/// Marks the first input sample in every error condition
+static void errorOnset(RESULT_t* res, uint32_t t, uint16_t code, uint8_t low, uint8_t shrt, uint8_t high){
+    uint8_t bit = 0;
+    if(code < SENSOR_OPEN_LIMIT) bit = low;
+    else if(code > SENSOR_SHORT_LIMIT) bit = shrt;
+    else if(analogToTemp(code) >= TEMP_HIGH_LIMIT) bit = high;
+
+    for(int i = 0; i < ERROR_BITS; i++){
+        if((bit == (1 << i)) && (res->onset[i] == NEVER)) res->onset[i] = t;
+    }
+}
+
+static void printTime(uint32_t t){
+    if(t == NEVER) printf("%10s", "-");
+    else printf("%9.3fs", t / 1000.0);
+}
+
+static void run(const SCENARIO_t* sc){
+    SIM_t sim;
+    RESULT_t res;
+
+    // Resets the mocks and the module
+    memset(&mockAdc0, 0, sizeof(mockAdc0));
+    memset(&mockAdc1, 0, sizeof(mockAdc1));
+    memset(mockDmac, 0, sizeof(mockDmac));
+    memset(&mockTc0, 0, sizeof(mockTc0));
+    memset(mockStatus, 0, sizeof(mockStatus));
+    memset(mockErrors, 0, sizeof(mockErrors));
+    mockFanPin = true;
+    MET_Can_Protocol_SetDefaultParameter(PROTO_PARAM_FAN_CONTROL, fanTargetPar, fanMinPar, fanMaxPar, 0);
+    XrayInit();
+    mockDmac[DMAC_CHANNEL_0].ring = statorRing;
+    mockDmac[DMAC_CHANNEL_1].ring = bulbRing;
+
+    memset(&sim, 0, sizeof(sim));
+    sim.temp = PLANT_AMBIENT;
+    sim.noise = 4.0;
+    sim.seed = seedPar;
+    if(sc->input == noiseInput) sim.temp = fanTargetPar;
+
+    memset(&res, 0, sizeof(res));
+    res.targetCross = res.fanStart = res.fanMax = NEVER;
+    for(int i = 0; i < ERROR_BITS; i++) res.onset[i] = res.set[i] = res.release[i] = NEVER;
+    res.dutyMin = 255;
+    res.tempMin = 1000;
+    res.tempMax = -1000;
+
+    // Fills the ring buffers with the initial condition
+    sc->input(&sim);
+    for(int i = 0; i < ADC_RING_DIM; i++){
+        adcSample(&mockAdc0, DMAC_CHANNEL_0, sim.stator);
+        adcSample(&mockAdc1, DMAC_CHANNEL_1, sim.bulb);
+    }
+
+    if(verbose) printf("time_s,stator_in_C,bulb_in_C,stator_C,bulb_C,duty,pers0\n");
+
+    for(sim.t = 0; sim.t < sc->duration; sim.t += SIM_TICK_MS){
+        sc->input(&sim);
+        adcSample(&mockAdc0, DMAC_CHANNEL_0, sim.stator);
+        adcSample(&mockAdc1, DMAC_CHANNEL_1, sim.bulb);
+
+        if(sim.t && ((sim.t % SIM_FAN_LOOP_MS) == 0)) XrayFanLoop();
+        if(sim.t && ((sim.t % SIM_XRAY_LOOP_MS) == 0)) XrayLoop();
+
+        uint8_t duty = fanDuty();
+
+        // Plant update
+        double g = PLANT_G_NATURAL + PLANT_G_FAN * duty / 100.0;
+        sim.temp += (sim.power - g * (sim.temp - PLANT_AMBIENT)) * (SIM_TICK_MS / 1000.0) / PLANT_CAPACITY;
+
+        // Fan response
+        double hottest = -1000;
+        if((sim.stator >= SENSOR_OPEN_LIMIT) && (sim.stator <= SENSOR_SHORT_LIMIT)) hottest = codeToTempC(sim.stator);
+        if((sim.bulb >= SENSOR_OPEN_LIMIT) && (sim.bulb <= SENSOR_SHORT_LIMIT)) hottest = fmax(hottest, codeToTempC(sim.bulb));
+        if((res.targetCross == NEVER) && (hottest > fanTargetPar)) res.targetCross = sim.t;
+        if(res.targetCross != NEVER){
+            if((res.fanStart == NEVER) && (duty > 0)) res.fanStart = sim.t;
+            if((res.fanMax == NEVER) && (duty >= fanMaxPar)) res.fanMax = sim.t;
+        }
+
+        // Error flags timing
+        errorOnset(&res, sim.t, sim.stator, PERS0_STATOR_SENS_LOW, PERS0_STATOR_SENS_SHORT, PERS0_STATOR_SENS_HIGH);
+        errorOnset(&res, sim.t, sim.bulb, PERS0_BULB_SENS_LOW, PERS0_BULB_SENS_SHORT, PERS0_BULB_SENS_HIGH);
+        for(int i = 0; i < ERROR_BITS; i++){
+            bool flag = (mockErrors[2] & (1 << i)) != 0;
+            if(flag && (res.set[i] == NEVER)) res.set[i] = sim.t;
+            if(!flag && (res.set[i] != NEVER) && (res.release[i] == NEVER)) res.release[i] = sim.t;
+        }
+
+        // Duty cycle oscillations: a reversal is counted when the duty cycle
+        // moves back from the last extreme by OSC_THRESHOLD at least
+        if(res.direction >= 0){
+            if(duty > res.extreme) res.extreme = duty;
+            else if(duty + OSC_THRESHOLD <= res.extreme){
+                if(res.direction > 0) res.reversals++;
+                res.direction = -1;
+                res.extreme = duty;
+            }
+        }
+        if(res.direction <= 0){
+            if(duty < res.extreme) res.extreme = duty;
+            else if(duty >= res.extreme + OSC_THRESHOLD){
+                if(res.direction < 0) res.reversals++;
+                res.direction = 1;
+                res.extreme = duty;
+            }
+        }
+        if(sim.t >= sc->duration / 2){
+            if(duty < res.dutyMin) res.dutyMin = duty;
+            if(duty > res.dutyMax) res.dutyMax = duty;
+            if((hottest > -1000) && (hottest < res.tempMin)) res.tempMin = hottest;
+            if(hottest > res.tempMax) res.tempMax = hottest;
+        }
+
+        if(verbose && ((sim.t % 1000) == 0)){
+            printf("%u,%.1f,%.1f,%d,%d,%u,0x%02x\n", sim.t / 1000, codeToTempC(sim.stator), codeToTempC(sim.bulb),
+                   GETBYTE_STATOR_TEMP, GETBYTE_BULB_TEMP, duty, mockErrors[2]);
+        }
+    }
+
+    printf("== %s: %s (%.0fs, target %uC, duty %u..%u%%)\n", sc->name, sc->description, sc->duration / 1000.0,
+           fanTargetPar, fanMinPar, fanMaxPar);
+    printf("  target crossing:");
+    printTime(res.targetCross);
+    printf("\n  fan response:    start ");
+    if((res.targetCross == NEVER) || (res.fanStart == NEVER)) printf("%10s", "-");
+    else printf("%9.3fs", (res.fanStart - res.targetCross) / 1000.0);
+    printf("   max ");
+    if((res.targetCross == NEVER) || (res.fanMax == NEVER)) printf("%10s", "-");
+    else printf("%9.3fs", (res.fanMax - res.targetCross) / 1000.0);
+    printf("\n");
+    if(sc->startLimit){
+        // The fan must start within the limit
+        if((res.targetCross == NEVER) || (res.fanStart == NEVER) || (res.fanStart - res.targetCross > sc->startLimit)){
+            printf("  FAIL: fan start later than %.3fs after the target crossing\n", sc->startLimit / 1000.0);
+            failed = 1;
+        }
+    }
+
+    for(int i = 0; i < ERROR_BITS; i++){
+        if((res.onset[i] == NEVER) && (res.set[i] == NEVER)) continue;
+        printf("  %-13s onset", errorNames[i]);
+        printTime(res.onset[i]);
+        printf("   set");
+        printTime(res.set[i]);
+        printf("   latency ");
+        if((res.onset[i] == NEVER) || (res.set[i] == NEVER)) printf("%10s", "-");
+        else printf("%9.3fs", ((double) res.set[i] - res.onset[i]) / 1000.0);
+        printf("   release");
+        printTime(res.release[i]);
+        printf("\n");
+    }
+
+    printf("  duty oscillations: %u reversals (>= %u%%), second half duty %u..%u%%, temperature %.1f..%.1fC\n",
+           res.reversals, OSC_THRESHOLD, res.dutyMin, res.dutyMax, res.tempMin, res.tempMax);
+}
+
+static void usage(void){
+    printf("usage: xray_replay [-v] [-t target] [-m min_duty] [-M max_duty] [-s seed] scenario|trace.csv ...\n");
+    printf("scenarios:\n");
+    for(int i = 0; i < SCENARIOS; i++) printf("  %-6s %s\n", scenarios[i].name, scenarios[i].description);
+    printf("  all    all the above\n");
+}
+
+int main(int argc, char** argv){
+    int runs = 0;
+
+    for(int i = 1; i < argc; i++){
+        if(!strcmp(argv[i], "-v")) verbose = 1;
+        else if(!strcmp(argv[i], "-t") && (i + 1 < argc)) fanTargetPar = (uint8_t) atoi(argv[++i]);
+        else if(!strcmp(argv[i], "-m") && (i + 1 < argc)) fanMinPar = (uint8_t) atoi(argv[++i]);
+        else if(!strcmp(argv[i], "-M") && (i + 1 < argc)) fanMaxPar = (uint8_t) atoi(argv[++i]);
+        else if(!strcmp(argv[i], "-s") && (i + 1 < argc)) seedPar = (uint32_t) atoi(argv[++i]);
+        else if(!strcmp(argv[i], "all")){
+            for(int j = 0; j < SCENARIOS; j++) run(&scenarios[j]);
+            runs++;
+        }else{
+            int j;
+            for(j = 0; j < SCENARIOS; j++){
+                if(!strcmp(argv[i], scenarios[j].name)) break;
+            }
+            if(j < SCENARIOS) run(&scenarios[j]);
+            else{
+                SCENARIO_t sc;
+                if(!traceLoad(argv[i], &sc)){
+                    fprintf(stderr, "%s: not a scenario or a readable trace\n", argv[i]);
+                    return 1;
+                }
+                run(&sc);
+            }
+            runs++;
+        }
+    }
+
+    if(!runs){
+        usage();
+        return 1;
+    }
+    return failed ? 2 : 0;
+}